@@ -56,15 +56,33 @@ protected:
   static const int n = 26;
   /// Array for letters
   IntVarArray le;
+  /// Whether to use a different branching for each asset
+  bool portfolio;
 public:
   /// Branching to use for model
   enum {
-    BRANCH_NONE,    ///< Choose variable left to right
-    BRANCH_INVERSE, ///< Choose variable right to left
-    BRANCH_SIZE     ///< Choose variable with smallest size
+    BRANCH_NONE,     ///< Choose variable left to right
+    BRANCH_INVERSE,  ///< Choose variable right to left
+    BRANCH_SIZE,     ///< Choose variable with smallest size
+    BRANCH_PORTFOLIO ///< Use a different branching for each asset
   };
+  /// Post branching \a b
+  void branching(int b) {
+    switch (b) {
+    case BRANCH_NONE:
+      branch(*this, le, INT_VAR_NONE, INT_VAL_MIN);
+      break;
+    case BRANCH_INVERSE:
+      branch(*this, le.slice(le.size()-1,-1), INT_VAR_NONE, INT_VAL_MIN);
+      break;
+    case BRANCH_SIZE:
+      branch(*this, le, INT_VAR_SIZE_MIN, INT_VAL_MIN);
+      break;
+    }
+  }
   /// Actual model
-  Alpha(const Options& opt) : le(*this,n,1,n) {
+  Alpha(const Options& opt) 
+    : le(*this,n,1,n), portfolio(opt.branching() == BRANCH_PORTFOLIO) {
     IntVar
       a(le[ 0]), b(le[ 1]), c(le[ 2]), e(le[ 4]), f(le[ 5]),
       g(le[ 6]), h(le[ 7]), i(le[ 8]), j(le[ 9]), k(le[10]),
@@ -95,21 +113,18 @@ public:
 
     distinct(*this, le, opt.icl());
 
-    switch (opt.branching()) {
-    case BRANCH_NONE:
-      branch(*this, le, INT_VAR_NONE, INT_VAL_MIN);
-      break;
-    case BRANCH_INVERSE:
-      branch(*this, le.slice(le.size()-1,-1), INT_VAR_NONE, INT_VAL_MIN);
-      break;
-    case BRANCH_SIZE:
-      branch(*this, le, INT_VAR_SIZE_MIN, INT_VAL_MIN);
-      break;
-    }
+    // For a portfolio, the branching is posted for each asset
+    if (!portfolio)
+      branching(opt.branching());
+  }
+  /// Post a different branching for asset \a i
+  virtual void asset(unsigned int i) {
+    if (portfolio)
+      branching(static_cast<int>(i % 3));
   }
 
   /// Constructor for cloning \a s
-  Alpha(bool share, Alpha& s) : Script(share,s) {
+  Alpha(bool share, Alpha& s) : Script(share,s), portfolio(s.portfolio) {
     le.update(*this, share, s.le);
   }
   /// Copy during cloning
@@ -142,6 +157,8 @@ main(int argc, char* argv[]) {
   opt.branching(Alpha::BRANCH_NONE, "none");
   opt.branching(Alpha::BRANCH_INVERSE, "inverse");
   opt.branching(Alpha::BRANCH_SIZE, "size");
+  opt.branching(Alpha::BRANCH_PORTFOLIO, "portfolio",
+                "different branching for each asset (see -assets)");
   opt.parse(argc,argv);
   Script::run<Alpha,DFS,Options>(opt);
   return 0;
@@ -0,0 +1,248 @@
+/* -*- mode: C++; c-basic-offset: 2; indent-tabs-mode: nil -*- */
+/*
+ *  Main authors:
+ *     Christian Schulte <schulte@gecode.org>
+ *
+ *  Copyright:
+ *     Christian Schulte, 2011
+ *
+ *  Last modified:
+ *     $Date$ by $Author$
+ *     $Revision$
+ *
+ *  This file is part of Gecode, the generic constraint
+ *  development environment:
+ *     http://www.gecode.org
+ *
+ *  Permission is hereby granted, free of charge, to any person obtaining
+ *  a copy of this software and associated documentation files (the
+ *  "Software"), to deal in the Software without restriction, including
+ *  without limitation the rights to use, copy, modify, merge, publish,
+ *  distribute, sublicense, and/or sell copies of the Software, and to
+ *  permit persons to whom the Software is furnished to do so, subject to
+ *  the following conditions:
+ *
+ *  The above copyright notice and this permission notice shall be
+ *  included in all copies or substantial portions of the Software.
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ *  EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ *  MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ *  NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE
+ *  LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+ *  OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+ *  WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ */
+
+
+#include <gecode/driver.hh>
+#include <gecode/int.hh>
+#include <gecode/minimodel.hh>
+
+#include <algorithm>
+
+using namespace Gecode;
+
+namespace {
+
+  /**
+   * \brief Parameters for generating a project scheduling instance
+   *
+   * The instances are generated in the spirit of the PSPLIB
+   * generator ProGen: jobs have durations between 1 and 10, each job
+   * has between one and three predecessors, and each job requires
+   * some of the four resources with a demand between 1 and 10. The
+   * resource strength determines the capacities: with strength 0 the
+   * capacity is the largest demand of a single job, with strength 1 it
+   * is the peak demand of the earliest start schedule.
+   */
+  class RCPSPSpec {
+  public:
+    int n;          ///< Number of jobs
+    double rs;      ///< Resource strength
+    unsigned int s; ///< Seed for random numbers
+  };
+
+  /// The instances
+  const RCPSPSpec specs[] = {
+    { 30, 0.2, 1}, { 30, 0.5, 2}, { 30, 0.7, 3},
+    { 60, 0.2, 4}, { 60, 0.5, 5}, { 60, 0.7, 6},
+    { 90, 0.2, 7}, { 90, 0.5, 8}, { 90, 0.7, 9},
+    {120, 0.2,10}, {120, 0.5,11}, {120, 0.7,12}
+  };
+  /// Number of instances
+  const unsigned int n_specs = sizeof(specs) / sizeof(RCPSPSpec);
+
+  /// Number of resources
+  const int n_res = 4;
+
+}
+
+/**
+ * \brief %Example: resource-constrained project scheduling
+ *
+ * Schedule jobs with precedences on renewable cumulative resources
+ * such that the makespan is minimal. The instances are generated
+ * similar to the instances from the PSPLIB (see RCPSPSpec) and serve
+ * as benchmarks for the cumulative constraint. The propagation
+ * strength of the cumulative constraints can be selected by the
+ * option \c -icl (with \c dom, time-table edge-finding is used in
+ * addition).
+ *
+ * \ingroup Example
+ *
+ */
+class RCPSP : public MinimizeScript {
+protected:
+  /// Start times of jobs
+  IntVarArray s;
+  /// Makespan
+  IntVar makespan;
+public:
+  /// The actual problem
+  RCPSP(const SizeOptions& opt)
+    : s(*this, specs[opt.size()].n) {
+    const RCPSPSpec& spec = specs[opt.size()];
+    int n = spec.n;
+    Support::RandomGenerator rnd(spec.s);
+
+    // Durations
+    IntArgs d(n);
+    for (int j=0; j<n; j++)
+      d[j] = 1 + static_cast<int>(rnd(10));
+
+    // Predecessors: job pred[3*j+l] must be finished before job j starts
+    Region r(*this);
+    int* pred = r.alloc<int>(3*n);
+    int* n_pred = r.alloc<int>(n);
+    for (int j=0; j<n; j++) {
+      n_pred[j] = 0;
+      if (j == 0)
+        continue;
+      int m = 1 + static_cast<int>(rnd(3));
+      for (int k=0; k<m; k++) {
+        // Choose among the recent jobs to obtain a deep network
+        int w = std::min(j, std::max(3, n/6));
+        int i = j - 1 - static_cast<int>(rnd(static_cast<unsigned int>(w)));
+        bool fresh = true;
+        for (int l=0; l<n_pred[j]; l++)
+          if (pred[3*j+l] == i)
+            fresh = false;
+        if (fresh)
+          pred[3*j+n_pred[j]++] = i;
+      }
+    }
+
+    // Demands
+    IntArgs u(n*n_res);
+    for (int j=0; j<n; j++) {
+      for (int k=0; k<n_res; k++)
+        u[j*n_res+k] = 0;
+      int m = 1 + static_cast<int>(rnd(n_res));
+      for (int k=0; k<m; k++)
+        u[j*n_res+static_cast<int>(rnd(n_res))] =
+          1 + static_cast<int>(rnd(10));
+    }
+
+    // Earliest start schedule
+    int* est = r.alloc<int>(n);
+    int horizon = 0;
+    for (int j=0; j<n; j++) {
+      est[j] = 0;
+      for (int l=0; l<n_pred[j]; l++)
+        est[j] = std::max(est[j], est[pred[3*j+l]] + d[pred[3*j+l]]);
+      horizon += d[j];
+    }
+
+    // Capacities from resource strength
+    IntArgs c(n_res);
+    {
+      int* usage = r.alloc<int>(horizon);
+      for (int k=0; k<n_res; k++) {
+        for (int t=0; t<horizon; t++)
+          usage[t] = 0;
+        int u_max = 0;
+        for (int j=0; j<n; j++) {
+          u_max = std::max(u_max, u[j*n_res+k]);
+          for (int t=est[j]; t<est[j]+d[j]; t++)
+            usage[t] += u[j*n_res+k];
+        }
+        int peak = 0;
+        for (int t=0; t<horizon; t++)
+          peak = std::max(peak, usage[t]);
+        c[k] = u_max + static_cast<int>(spec.rs * (peak - u_max));
+      }
+    }
+
+    // Start times and makespan
+    for (int j=0; j<n; j++)
+      s[j] = IntVar(*this, est[j], horizon - d[j]);
+    makespan = IntVar(*this, 0, horizon);
+    for (int j=0; j<n; j++) {
+      rel(*this, s[j] + d[j] <= makespan);
+      for (int l=0; l<n_pred[j]; l++)
+        rel(*this, s[pred[3*j+l]] + d[pred[3*j+l]] <= s[j]);
+    }
+
+    // Post cumulative constraints for the jobs using a resource
+    for (int k=0; k<n_res; k++) {
+      IntVarArgs sk; IntArgs dk, uk;
+      for (int j=0; j<n; j++)
+        if (u[j*n_res+k] > 0) {
+          sk << s[j]; dk << d[j]; uk << u[j*n_res+k];
+        }
+      cumulative(*this, c[k], sk, dk, uk, opt.icl());
+    }
+
+    // Schedule jobs as early as possible
+    branch(*this, s, INT_VAR_MIN_MIN, INT_VAL_MIN);
+    assign(*this, makespan, INT_ASSIGN_MIN);
+  }
+
+  /// Constructor for cloning \a r
+  RCPSP(bool share, RCPSP& r) : MinimizeScript(share,r) {
+    s.update(*this, share, r.s);
+    makespan.update(*this, share, r.makespan);
+  }
+
+  /// Perform copying during cloning
+  virtual Space*
+  copy(bool share) {
+    return new RCPSP(share,*this);
+  }
+
+  /// Minimize the makespan
+  virtual IntVar
+  cost(void) const {
+    return makespan;
+  }
+
+  /// Print solution
+  virtual void
+  print(std::ostream& os) const {
+    os << "\tMakespan: " << makespan << std::endl
+       << "\tStart times: " << s << std::endl;
+  }
+
+};
+
+/** \brief Main-function
+ *  \relates RCPSP
+ */
+int
+main(int argc, char* argv[]) {
+  SizeOptions opt("RCPSP");
+  opt.size(0);
+  opt.solutions(0);
+  opt.parse(argc,argv);
+  if (opt.size() >= n_specs) {
+    std::cerr << "Error: size must be between 0 and "
+              << n_specs-1 << std::endl;
+    return 1;
+  }
+  MinimizeScript::run<RCPSP,BAB,SizeOptions>(opt);
+  return 0;
+}
+
+// STATISTICS: example-any
@@ -542,6 +542,19 @@ AC_DEFUN([AC_GECODE_AUDIT],
         AC_MSG_RESULT(no)
      fi])
 
+AC_DEFUN([AC_GECODE_PROPAGATOR_PROFILE],
+    [AC_ARG_ENABLE([propagator-profile],
+       AC_HELP_STRING([--enable-propagator-profile],
+         [build with propagator execution profile @<:@default=no@:>@]))
+     AC_MSG_CHECKING(whether to build with propagator execution profile)
+     if test "${enable_propagator_profile:-no}" = "yes"; then
+        AC_DEFINE([GECODE_PROPAGATOR_PROFILE],[],
+                  [Whether to include propagator execution profile])
+        AC_MSG_RESULT(yes)
+     else
+        AC_MSG_RESULT(no)
+     fi])
+
 
 AC_DEFUN([AC_GECODE_PROFILE],
      [AC_ARG_ENABLE([profile],
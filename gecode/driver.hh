@@ -102,6 +102,18 @@ namespace Gecode {
     SM_GIST      ///< Run script in Gist
   };
 
+  /**
+   * \brief Different modes for restarts
+   * \ingroup TaskDriverCmd
+   */
+  enum RestartMode {
+    RM_NONE,     ///< No restarts
+    RM_CONSTANT, ///< Restart with constant sequence
+    RM_LINEAR,   ///< Restart with linear sequence
+    RM_LUBY,     ///< Restart with Luby sequence
+    RM_GEOMETRIC ///< Restart with geometric sequence
+  };
+
   class BaseOptions;
 
   namespace Driver {
@@ -237,7 +249,7 @@ namespace Gecode {
       double cur; ///< Current value
     public:
       /// Initialize for option \a o and explanation \a e and default value \a v
-      DoubleOption(const char* o, const char* e, unsigned int v=0);
+      DoubleOption(const char* o, const char* e, double v=0.0);
       /// Set default value to \a v
       void value(double v);
       /// Return current option value
@@ -319,8 +331,18 @@ namespace Gecode {
     Driver::StringOption      _search;    ///< Search options
     Driver::UnsignedIntOption _solutions; ///< How many solutions
     Driver::DoubleOption      _threads;   ///< How many threads to use
+    Driver::StringOption      _affinity;  ///< How to place threads
+    Driver::StringOption      _restore;   ///< How to restore spaces
     Driver::UnsignedIntOption _c_d;       ///< Copy recomputation distance
     Driver::UnsignedIntOption _a_d;       ///< Adaptive recomputation distance
+    Driver::UnsignedIntOption _d_l;       ///< Discrepancy limit for LDS
+    Driver::StringOption      _restart;   ///< Restart method option
+    Driver::UnsignedIntOption _r_scale;   ///< Restart scale factor
+    Driver::DoubleOption      _r_base;    ///< Restart base
+    Driver::UnsignedIntOption _nogoods_limit; ///< Depth limit for nogoods
+    Driver::UnsignedIntOption _learn;     ///< Depth limit for learning
+    Driver::UnsignedIntOption _f_l;       ///< Failure limit for LNS
+    Driver::UnsignedIntOption _assets;    ///< Number of portfolio assets
     Driver::UnsignedIntOption _node;      ///< Cutoff for number of nodes
     Driver::UnsignedIntOption _fail;      ///< Cutoff for number of failures
     Driver::UnsignedIntOption _time;      ///< Cutoff for time
@@ -332,6 +354,9 @@ namespace Gecode {
     Driver::StringOption      _mode;       ///< Script mode to run
     Driver::UnsignedIntOption _samples;    ///< How many samples
     Driver::UnsignedIntOption _iterations; ///< How many iterations per sample
+#ifdef GECODE_PROPAGATOR_PROFILE
+    Driver::StringValueOption _profile;    ///< File for propagator profile
+#endif
     //@}
 
   public:
@@ -392,6 +417,16 @@ namespace Gecode {
     void threads(double n);
     /// Return number of parallel threads
     double threads(void) const;
+
+    /// Set default placement of parallel threads
+    void affinity(Search::Affinity a);
+    /// Return placement of parallel threads
+    Search::Affinity affinity(void) const;
+    
+    /// Set default restoration of spaces during backtracking
+    void restore(Search::Restore r);
+    /// Return restoration of spaces during backtracking
+    Search::Restore restore(void) const;
     
     /// Set default copy recomputation distance
     void c_d(unsigned int d);
@@ -403,6 +438,46 @@ namespace Gecode {
     /// Return adaptive recomputation distance
     unsigned int a_d(void) const;
     
+    /// Set default discrepancy limit for LDS
+    void d_l(unsigned int d);
+    /// Return discrepancy limit for LDS
+    unsigned int d_l(void) const;
+    
+    /// Set default restart mode
+    void restart(RestartMode r);
+    /// Return restart mode
+    RestartMode restart(void) const;
+    
+    /// Set default restart scale factor
+    void restart_scale(unsigned int s);
+    /// Return restart scale factor
+    unsigned int restart_scale(void) const;
+    
+    /// Set default restart base
+    void restart_base(double b);
+    /// Return restart base
+    double restart_base(void) const;
+    
+    /// Set default depth limit for nogoods
+    void nogoods_limit(unsigned int l);
+    /// Return depth limit for nogoods
+    unsigned int nogoods_limit(void) const;
+    
+    /// Set default depth limit for learning from failures
+    void learn(unsigned int l);
+    /// Return depth limit for learning from failures
+    unsigned int learn(void) const;
+    
+    /// Set default failure limit for each neighbourhood in LNS
+    void f_l(unsigned int f);
+    /// Return failure limit for each neighbourhood in LNS
+    unsigned int f_l(void) const;
+    
+    /// Set default number of assets for portfolio search
+    void assets(unsigned int n);
+    /// Return number of assets for portfolio search
+    unsigned int assets(void) const;
+    
     /// Set default node cutoff
     void node(unsigned int n);
     /// Return node cutoff
@@ -440,6 +515,13 @@ namespace Gecode {
     void samples(unsigned int s);
     /// Return number of samples
     unsigned int samples(void) const;
+
+#ifdef GECODE_PROPAGATOR_PROFILE
+    /// Set default file name for propagator profile
+    void profile(const char* f);
+    /// Return file name for propagator profile (NULL if none)
+    const char* profile(void) const;
+#endif
     //@}
 
 #ifdef GECODE_HAS_GIST
@@ -351,8 +351,23 @@ namespace Gecode {
       _solutions("-solutions","number of solutions (0 = all)",1),
       _threads("-threads","number of threads (0 = #processing units)",
                Search::Config::threads),
+      _affinity("-affinity","placement of threads",Search::Config::affinity),
+      _restore("-restore","restoration of spaces during backtracking",
+               Search::Config::restore),
       _c_d("-c-d","recomputation commit distance",Search::Config::c_d),
       _a_d("-a-d","recomputation adaptation distance",Search::Config::a_d),
+      _d_l("-d-l","discrepancy limit for LDS",Search::Config::d_l),
+      _restart("-restart","restart sequence (restart search engine)",RM_NONE),
+      _r_scale("-restart-scale","scale factor for restart sequence",250),
+      _r_base("-restart-base","base for geometric restart sequence",1.5),
+      _nogoods_limit("-nogoods-limit","depth limit for nogoods at restarts",
+                     Search::Config::nogoods_limit),
+      _learn("-learn","depth limit for learning from failures (0 = none)",
+             Search::Config::learn),
+      _f_l("-f-l","failure limit for each neighbourhood in LNS",
+           Search::Config::f_l),
+      _assets("-assets","number of assets for portfolio search (0 = #threads)",
+              1),
       _node("-node","node cutoff (0 = none, solution mode)"),
       _fail("-fail","failure cutoff (0 = none, solution mode)"),
       _time("-time","time (in ms) cutoff (0 = none, solution mode)"),
@@ -361,11 +376,33 @@ namespace Gecode {
       _mode("-mode","how to execute script",SM_SOLUTION),
       _samples("-samples","how many samples (time mode)",1),
       _iterations("-iterations","iterations per sample (time mode)",1)
+#ifdef GECODE_PROPAGATOR_PROFILE
+      , _profile("-profile","file for propagator profile (csv)")
+#endif
   {
     
     _icl.add(ICL_DEF, "def"); _icl.add(ICL_VAL, "val");
     _icl.add(ICL_BND, "bnd"); _icl.add(ICL_DOM, "dom");
     
+    _affinity.add(Search::AFF_NONE, "none",
+                  "leave placement to operating system");
+    _affinity.add(Search::AFF_CORE, "core",
+                  "bind each thread to a processing unit");
+    _affinity.add(Search::AFF_NODE, "node",
+                  "bind each thread to a NUMA node");
+
+    _restore.add(Search::RS_COPY, "copy",
+                 "copying and recomputation (see -c-d and -a-d)");
+    _restore.add(Search::RS_RECOMPUTE, "recompute",
+                 "recomputation from the root only");
+
+    _restart.add(RM_NONE, "none",
+                 "restart only when a better solution is found");
+    _restart.add(RM_CONSTANT, "constant");
+    _restart.add(RM_LINEAR, "linear");
+    _restart.add(RM_LUBY, "luby");
+    _restart.add(RM_GEOMETRIC, "geometric");
+
     _mode.add(SM_SOLUTION, "solution");
     _mode.add(SM_TIME, "time");
     _mode.add(SM_STAT, "stat");
@@ -376,9 +413,16 @@ namespace Gecode {
     
     add(_model); add(_symmetry); add(_propagation); add(_icl); 
     add(_branching);
-    add(_search); add(_solutions); add(_threads); add(_c_d); add(_a_d);
+    add(_search); add(_solutions); add(_threads); add(_affinity);
+    add(_restore); add(_c_d); add(_a_d); add(_d_l);
+    add(_restart); add(_r_scale); add(_r_base); add(_nogoods_limit);
+    add(_learn);
+    add(_f_l); add(_assets);
     add(_node); add(_fail); add(_time); add(_interrupt);
     add(_mode); add(_iterations); add(_samples);
+#ifdef GECODE_PROPAGATOR_PROFILE
+    add(_profile);
+#endif
   }
 
   
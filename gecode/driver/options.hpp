@@ -114,7 +114,7 @@ namespace Gecode {
      */
     inline
     DoubleOption::DoubleOption(const char* o, const char* e,
-                               unsigned int v)
+                               double v)
       : BaseOption(o,e), cur(v) {}
     inline void
     DoubleOption::value(double v) {
@@ -264,6 +264,24 @@ namespace Gecode {
   Options::threads(void) const {
     return _threads.value();
   }
+
+  inline void
+  Options::affinity(Search::Affinity a) {
+    _affinity.value(a);
+  }
+  inline Search::Affinity
+  Options::affinity(void) const {
+    return static_cast<Search::Affinity>(_affinity.value());
+  }
+
+  inline void
+  Options::restore(Search::Restore r) {
+    _restore.value(r);
+  }
+  inline Search::Restore
+  Options::restore(void) const {
+    return static_cast<Search::Restore>(_restore.value());
+  }
   
   inline void
   Options::c_d(unsigned int d) {
@@ -283,6 +301,78 @@ namespace Gecode {
     return _a_d.value();
   }
   
+  inline void
+  Options::d_l(unsigned int d) {
+    _d_l.value(d);
+  }
+  inline unsigned int
+  Options::d_l(void) const {
+    return _d_l.value();
+  }
+  
+  inline void
+  Options::restart(RestartMode r) {
+    _restart.value(r);
+  }
+  inline RestartMode
+  Options::restart(void) const {
+    return static_cast<RestartMode>(_restart.value());
+  }
+  
+  inline void
+  Options::restart_scale(unsigned int s) {
+    _r_scale.value(s);
+  }
+  inline unsigned int
+  Options::restart_scale(void) const {
+    return _r_scale.value();
+  }
+  
+  inline void
+  Options::restart_base(double b) {
+    _r_base.value(b);
+  }
+  inline double
+  Options::restart_base(void) const {
+    return _r_base.value();
+  }
+  
+  inline void
+  Options::nogoods_limit(unsigned int l) {
+    _nogoods_limit.value(l);
+  }
+  inline unsigned int
+  Options::nogoods_limit(void) const {
+    return _nogoods_limit.value();
+  }
+  
+  inline void
+  Options::learn(unsigned int l) {
+    _learn.value(l);
+  }
+  inline unsigned int
+  Options::learn(void) const {
+    return _learn.value();
+  }
+  
+  inline void
+  Options::f_l(unsigned int f) {
+    _f_l.value(f);
+  }
+  inline unsigned int
+  Options::f_l(void) const {
+    return _f_l.value();
+  }
+  
+  inline void
+  Options::assets(unsigned int n) {
+    _assets.value(n);
+  }
+  inline unsigned int
+  Options::assets(void) const {
+    return _assets.value();
+  }
+  
   inline void
   Options::node(unsigned int n) {
     _node.value(n);
@@ -351,6 +441,17 @@ namespace Gecode {
     return _samples.value();
   }
 
+#ifdef GECODE_PROPAGATOR_PROFILE
+  inline void
+  Options::profile(const char* f) {
+    _profile.value(f);
+  }
+  inline const char*
+  Options::profile(void) const {
+    return _profile.value();
+  }
+#endif
+
 #ifdef GECODE_HAS_GIST
   forceinline
   Options::_I::_I(void) : _click(heap,1), n_click(0),
@@ -42,6 +42,25 @@
 
 namespace Gecode { namespace Driver {
     
+  Search::Cutoff*
+  cutoff(const Options& o) {
+    switch (o.restart()) {
+    case RM_NONE:
+      return NULL;
+    case RM_CONSTANT:
+      return Search::Cutoff::constant(o.restart_scale());
+    case RM_LINEAR:
+      return Search::Cutoff::linear(o.restart_scale());
+    case RM_LUBY:
+      return Search::Cutoff::luby(o.restart_scale());
+    case RM_GEOMETRIC:
+      return Search::Cutoff::geometric(o.restart_scale(),o.restart_base());
+    default:
+      GECODE_NEVER;
+    }
+    return NULL;
+  }
+
   void 
   stop(Support::Timer& timer, std::ostream& os) {
     double t = timer.stop();
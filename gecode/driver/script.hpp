@@ -38,6 +38,7 @@
 
 #include <iostream>
 #include <iomanip>
+#include <fstream>
 
 #ifndef GECODE_THREADS_WINDOWS
 #include <csignal>
@@ -130,6 +131,14 @@ namespace Gecode { namespace Driver {
     }
   };
 
+  /**
+   * \brief Create cutoff sequence for restarts according to options \a o
+   *
+   * Returns NULL if no restarts are requested.
+   */
+  GECODE_DRIVER_EXPORT Search::Cutoff*
+  cutoff(const Options& o);
+
   /**
    * \brief Get time since start of timer and print user friendly time
    * information.
@@ -185,6 +194,24 @@ namespace Gecode { namespace Driver {
     }
   };
   
+  /// Specialization for LDS (explored depth-first)
+  template<typename S>
+  class GistEngine<LDS<S> > {
+  public:
+    static void explore(S* root, const Gist::Options& opt) {
+      (void) Gist::dfs(root, opt);
+    }
+  };
+  
+  /// Specialization for LNS (explored by branch-and-bound)
+  template<typename S>
+  class GistEngine<LNS<S> > {
+  public:
+    static void explore(S* root, const Gist::Options& opt) {
+      (void) Gist::bab(root, opt);
+    }
+  };
+  
 #endif
 
   template<class Space>
@@ -214,6 +241,8 @@ namespace Gecode { namespace Driver {
           for (int i=0; o.inspect.compare(i) != NULL; i++)
             opt.inspect.compare(o.inspect.compare(i));
           Script* s = new Script(o);
+          // Gist explores the first asset only
+          s->asset(0);
           (void) GistEngine<Engine<Script> >::explore(s, opt);
         }
         break;
@@ -230,14 +259,22 @@ namespace Gecode { namespace Driver {
           unsigned int n_b = s->branchers();
           Search::Options so;
           so.threads = o.threads();
+          so.affinity = o.affinity();
+          so.restore  = o.restore();
           so.c_d     = o.c_d();
           so.a_d     = o.a_d();
+          so.d_l     = o.d_l();
+          so.cutoff  = cutoff(o);
+          so.nogoods_limit = o.nogoods_limit();
+          so.learn   = o.learn();
+          so.f_l     = o.f_l();
+          so.assets  = o.assets();
           so.stop    = Cutoff::create(o.node(),o.fail(), o.time(), 
                                       o.interrupt());
           so.clone   = false;
           if (o.interrupt())
             Cutoff::installCtrlHandler(true);
-          Engine<Script> e(s,so);
+          Portfolio<Script,Engine> e(s,so);
           do {
             Script* ex = e.next();
             if (ex == NULL)
@@ -282,7 +319,12 @@ namespace Gecode { namespace Driver {
                << "\tpeak memory:  "
                << static_cast<int>((stat.memory+1023) / 1024) << " KB"
                << endl;
+          if (so.cutoff != NULL)
+            cout << "\trestarts:     " << stat.restart << endl;
+          if ((so.cutoff != NULL) || (so.learn > 0))
+            cout << "\tnogoods:      " << stat.nogood << endl;
           delete so.stop;
+          delete so.cutoff;
         }
         break;
       case SM_STAT:
@@ -297,13 +339,21 @@ namespace Gecode { namespace Driver {
           Search::Options so;
           so.clone   = false;
           so.threads = o.threads();
+          so.affinity = o.affinity();
+          so.restore  = o.restore();
           so.c_d     = o.c_d();
           so.a_d     = o.a_d();
+          so.d_l     = o.d_l();
+          so.cutoff  = cutoff(o);
+          so.nogoods_limit = o.nogoods_limit();
+          so.learn   = o.learn();
+          so.f_l     = o.f_l();
+          so.assets  = o.assets();
           so.stop    = Cutoff::create(o.node(),o.fail(), o.time(),
                                       o.interrupt());
           if (o.interrupt())
             Cutoff::installCtrlHandler(true);
-          Engine<Script> e(s,so);
+          Portfolio<Script,Engine> e(s,so);
           do {
             Script* ex = e.next();
             if (ex == NULL)
@@ -328,6 +378,12 @@ namespace Gecode { namespace Driver {
                << "\tpeak memory:  "
                << static_cast<int>((stat.memory+1023) / 1024) << " KB"
                << endl;
+          if (so.cutoff != NULL)
+            cout << "\trestarts:     " << stat.restart << endl;
+          if ((so.cutoff != NULL) || (so.learn > 0))
+            cout << "\tnogoods:      " << stat.nogood << endl;
+          delete so.stop;
+          delete so.cutoff;
         }
         break;
       case SM_TIME:
@@ -344,10 +400,18 @@ namespace Gecode { namespace Driver {
               Search::Options so;
               so.clone   = false;
               so.threads = o.threads();
+              so.affinity = o.affinity();
+              so.restore  = o.restore();
               so.c_d     = o.c_d();
               so.a_d     = o.a_d();
+              so.d_l     = o.d_l();
+              so.cutoff  = cutoff(o);
+              so.nogoods_limit = o.nogoods_limit();
+              so.learn   = o.learn();
+              so.f_l     = o.f_l();
+              so.assets  = o.assets();
               so.stop    = Cutoff::create(o.node(),o.fail(), o.time(), false);
-              Engine<Script> e(s,so);
+              Portfolio<Script,Engine> e(s,so);
               do {
                 Script* ex = e.next();
                 if (ex == NULL)
@@ -357,6 +421,7 @@ namespace Gecode { namespace Driver {
               if (e.stopped())
                 stopped = true;
               delete so.stop;
+              delete so.cutoff;
             }
             ts[s] = t.stop() / o.iterations();
           }
@@ -376,6 +441,12 @@ namespace Gecode { namespace Driver {
         }
         break;
       }
+#ifdef GECODE_PROPAGATOR_PROFILE
+      if (o.profile() != NULL) {
+        ofstream pf(o.profile());
+        PropagatorProfile::print(pf);
+      }
+#endif
     } catch (Exception e) {
       cerr << "Exception: " << e.what() << "." << endl
            << "Stopping..." << endl;
@@ -163,6 +163,7 @@ namespace Gecode { namespace FlatZinc {
       Gecode::Driver::StringOption      _search; ///< Search engine variant
       Gecode::Driver::UnsignedIntOption _c_d;       ///< Copy recomputation distance
       Gecode::Driver::UnsignedIntOption _a_d;       ///< Adaptive recomputation distance
+      Gecode::Driver::UnsignedIntOption _assets;    ///< Number of portfolio assets
       Gecode::Driver::UnsignedIntOption _node;      ///< Cutoff for number of nodes
       Gecode::Driver::UnsignedIntOption _fail;      ///< Cutoff for number of failures
       Gecode::Driver::UnsignedIntOption _time;      ///< Cutoff for time
@@ -191,6 +192,7 @@ namespace Gecode { namespace FlatZinc {
       _search("-search","search engine variant", FZ_SEARCH_BAB),
       _c_d("-c-d","recomputation commit distance",Gecode::Search::Config::c_d),
       _a_d("-a-d","recomputation adaption distance",Gecode::Search::Config::a_d),
+      _assets("-assets","number of assets for portfolio search",1),
       _node("-node","node cutoff (0 = none, solution mode)"),
       _fail("-fail","failure cutoff (0 = none, solution mode)"),
       _time("-time","time (in ms) cutoff (0 = none, solution mode)"),
@@ -206,7 +208,7 @@ namespace Gecode { namespace FlatZinc {
       _mode.add(Gecode::SM_GIST, "gist");
       _print.add(0,"all");
       _print.add(1,"last");
-      add(_solutions); add(_threads); add(_c_d); add(_a_d);
+      add(_solutions); add(_threads); add(_c_d); add(_a_d); add(_assets);
       add(_allSolutions);
       add(_free);
       add(_search);
@@ -238,6 +240,7 @@ namespace Gecode { namespace FlatZinc {
     }
     unsigned int c_d(void) const { return _c_d.value(); }
     unsigned int a_d(void) const { return _a_d.value(); }
+    unsigned int assets(void) const { return _assets.value(); }
     unsigned int node(void) const { return _node.value(); }
     unsigned int fail(void) const { return _fail.value(); }
     unsigned int time(void) const { return _time.value(); }
@@ -361,9 +364,14 @@ namespace Gecode { namespace FlatZinc {
      *
      * If \a ignoreUnknown is true, unknown solve item annotations will be
      * ignored, otherwise a warning is written to \a err.
+     *
+     * If \a seed is not zero, ties in the variable selection for the
+     * variables not covered by annotations are broken randomly using
+     * \a seed (used for diversifying the assets of a portfolio).
      */
     void createBranchers(AST::Node* ann, bool ignoreUnknown,
-                         std::ostream& err = std::cerr);
+                         std::ostream& err = std::cerr,
+                         unsigned int seed = 0);
 
     /// Return the solve item annotations
     AST::Array* solveAnnotations(void) const;
@@ -357,7 +357,7 @@ namespace Gecode { namespace FlatZinc {
 
   void
   FlatZincSpace::createBranchers(AST::Node* ann, bool ignoreUnknown,
-                                 std::ostream& err) {
+                                 std::ostream& err, unsigned int seed) {
     if (ann) {
       std::vector<AST::Node*> flatAnn;
       if (ann->isArray()) {
@@ -486,8 +486,18 @@ namespace Gecode { namespace FlatZinc {
       else
         bv_sol[k++] = bv[i];
 
-    branch(*this, iv_sol, INT_VAR_SIZE_AFC_MIN, INT_VAL_MIN);
-    branch(*this, bv_sol, INT_VAR_AFC_MIN, INT_VAL_MIN);
+    if (seed == 0) {
+      branch(*this, iv_sol, INT_VAR_SIZE_AFC_MIN, INT_VAL_MIN);
+      branch(*this, bv_sol, INT_VAR_AFC_MIN, INT_VAL_MIN);
+    } else {
+      VarBranchOptions rnd;
+      rnd.seed = seed;
+      TieBreakVarBranchOptions tbo(VarBranchOptions::def, rnd);
+      branch(*this, iv_sol, tiebreak(INT_VAR_SIZE_AFC_MIN, INT_VAR_RND),
+             INT_VAL_MIN, tbo);
+      branch(*this, bv_sol, tiebreak(INT_VAR_AFC_MIN, INT_VAR_RND),
+             INT_VAL_MIN, tbo);
+    }
 #ifdef GECODE_HAS_SET_VARS
     introduced = 0;
     for (int i=sv.size(); i--;)
@@ -658,7 +668,8 @@ namespace Gecode { namespace FlatZinc {
     unsigned int n_p = 0;
     Support::Timer t_solve;
     t_solve.start();
-    if (status(sstat) != SS_FAILED) {
+    bool failed = (status(sstat) == SS_FAILED);
+    if (!failed) {
       n_p = propagators();
     }
     Search::Options o;
@@ -668,7 +679,29 @@ namespace Gecode { namespace FlatZinc {
     o.a_d = opt.a_d();
     o.threads = opt.threads();
     Driver::Cutoff::installCtrlHandler(true);
-    Engine<FlatZincSpace> se(this,o);
+    Portfolio<FlatZincSpace,Engine>* pse;
+    unsigned int n = opt.assets();
+    if ((n > 1) && !failed) {
+      // The first asset follows the annotations, all others use free
+      // search with random tie-breaking
+      FlatZincSpace** a = heap.alloc<FlatZincSpace*>(n);
+      for (unsigned int i=0; i<n; i++) {
+        a[i] = static_cast<FlatZincSpace*>(clone(false));
+        a[i]->iv_introduced = iv_introduced;
+        a[i]->bv_introduced = bv_introduced;
+#ifdef GECODE_HAS_SET_VARS
+        a[i]->sv_introduced = sv_introduced;
+#endif
+        a[i]->createBranchers((i == 0) ? _solveAnnotations : NULL,
+                              false, std::cerr, i);
+      }
+      pse = new Portfolio<FlatZincSpace,Engine>(a,n,o);
+      heap.free<FlatZincSpace*>(a,n);
+    } else {
+      o.assets = 1;
+      pse = new Portfolio<FlatZincSpace,Engine>(this,o);
+    }
+    Portfolio<FlatZincSpace,Engine>& se = *pse;
     int noOfSolutions = _method == SAT ? opt.solutions() : 0;
     int findSol = noOfSolutions;
     FlatZincSpace* sol = NULL;
@@ -720,6 +753,7 @@ namespace Gecode { namespace FlatZinc {
            << static_cast<int>((stat.memory+1023) / 1024) << " KB"
            << endl;
     }
+    delete pse;
   }
 
 #ifdef GECODE_HAS_QT
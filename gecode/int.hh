@@ -49,6 +49,7 @@
 #include <climits>
 #include <cfloat>
 #include <iostream>
+#include <string>
 
 #include <vector>
 
@@ -1663,6 +1664,8 @@ namespace Gecode {
    */
   //@{
 
+  class TupleSet;
+
   /**
    * \brief Deterministic finite automaton (%DFA)
    *
@@ -1722,6 +1725,10 @@ namespace Gecode {
       /// Return current symbol
       int val(void) const;
     };
+  private:
+    /// Initialize DFA (see constructor for parameters)
+    GECODE_INT_EXPORT
+    void init(int s, Transition t[], int f[], bool minimize);
   public:
     friend class Transitions;
     /// Initialize for DFA accepting the empty word
@@ -1739,6 +1746,19 @@ namespace Gecode {
      */
     GECODE_INT_EXPORT
     DFA(int s, Transition t[], int f[], bool minimize=true);
+    /**
+     * \brief Initialize DFA as multi-valued decision diagram for tuple set \a ts
+     *
+     * The DFA accepts exactly the tuples of the finalized tuple set
+     * \a ts. It is layered: the states on layer \f$i\f$ correspond
+     * to the different sets of suffixes for the prefixes of length
+     * \f$i\f$ of the tuples, that is, isomorphic nodes are shared.
+     * Posting an extensional constraint with this DFA hence
+     * propagates on the reduced decision diagram of the tuple set,
+     * which can be much smaller than the tuple set itself.
+     */
+    GECODE_INT_EXPORT
+    explicit DFA(const TupleSet& ts);
     /// Initialize by DFA \a d (DFA is shared)
     DFA(const DFA& d);
     /// Return the number of states
@@ -1768,9 +1788,10 @@ namespace Gecode {
    *
    */
   enum ExtensionalPropKind {
-    EPK_DEF,    ///< Make a default decision
-    EPK_SPEED,  ///< Prefer speed over memory consumption
-    EPK_MEMORY  ///< Prefer little memory over speed
+    EPK_DEF,     ///< Make a default decision
+    EPK_SPEED,   ///< Prefer speed over memory consumption
+    EPK_MEMORY,  ///< Prefer little memory over speed
+    EPK_COMPACT  ///< Use bitsets of valid tuples (compact tables)
   };
 
   /**
@@ -1826,10 +1847,16 @@ namespace Gecode {
       int arity;
       /// Number of Tuples
       int size;
-      /// Tuples index
-      Tuple** tuples;
-      /// Tuple index data
-      Tuple* tuple_data;
+      /** \brief Tuples index
+       *
+       * For each variable \f$i\f$ the numbers of all tuples sorted
+       * by their \f$i\f$-th value, stored at positions
+       * \f$i\cdot\mathit{size}\f$ to \f$(i+1)\cdot\mathit{size}-1\f$.
+       * The entry at position end() has value \a size and refers to
+       * no tuple. Using tuple numbers rather than pointers makes the
+       * index position-independent.
+       */
+      unsigned int* index;
       /// Tuples data
       int* data;
       /// Excess storage
@@ -1838,10 +1865,12 @@ namespace Gecode {
       int min, max;
       /// Domain size
       unsigned int domsize;
-      /// Initial last structure
-      Tuple** last;
-      /// Pointer to NULL-pointer
-      Tuple* nullpointer;
+      /// Initial last structure (positions in index)
+      unsigned int* last;
+      /// Number of words for a support bitset
+      unsigned int words;
+      /// Support bitsets for all values of all variables (NULL if not yet computed)
+      Support::BitSetData* supports;
 
       /// Add Tuple. Assumes that arity matches.
       template<class T>
@@ -1852,6 +1881,20 @@ namespace Gecode {
       GECODE_INT_EXPORT void resize(void);
       /// Is datastructure finalized
       bool finalized(void) const;
+      /// Compute support bitsets (if not yet done)
+      GECODE_INT_EXPORT void init_supports(void);
+      /// Return support bitset for variable \a i and value \a n
+      const Support::BitSetData* support(int i, int n) const;
+      /// Return tuple with number \a t (NULL if \a t is \a size)
+      Tuple tuple(unsigned int t) const;
+      /// Return position in index that refers to no tuple
+      unsigned int end(void) const;
+      /// Memory-mapped storage (shared among copies)
+      class Mapping;
+      /// Mapping for storage (NULL if data is allocated on the heap)
+      Mapping* mapping;
+      /// Read finalized tuple set from file \a fn
+      GECODE_INT_EXPORT void load(const std::string& fn);
       /// Initialize as empty tuple set
       TupleSetI(void);
       /// Delete  implementation
@@ -1867,6 +1910,16 @@ namespace Gecode {
     TupleSet(void);
     /// Initialize by TupleSet \a d (tuple set is shared)
     TupleSet(const TupleSet& d);
+    /** \brief Initialize from file \a fn as written by save
+     *
+     * The tuple set is finalized. If supported by the platform, the
+     * file is mapped read-only into memory rather than copied, such
+     * that several processes using the same file share its storage.
+     *
+     * Throws an exception of type Int::TupleSetFileError, if the file
+     * cannot be read or has not been written by save.
+     */
+    GECODE_INT_EXPORT explicit TupleSet(const std::string& fn);
 
     /// Add tuple to tuple set
     void add(const IntArgs& tuple);
@@ -1884,12 +1937,24 @@ namespace Gecode {
     int min(void) const;
     /// Maximum domain element
     int max(void) const;
+    /** \brief Save tuple set to file \a fn
+     *
+     * The tuple set must be finalized. The file uses the native
+     * byte order and can be read by the constructor TupleSet(fn).
+     *
+     * Throws an exception of type Int::NotYetFinalized, if the tuple
+     * set is not finalized and of type Int::TupleSetFileError, if the
+     * file cannot be written.
+     */
+    GECODE_INT_EXPORT void save(const std::string& fn) const;
   };
 
   /** \brief Post propagator for \f$x\in t\f$.
    *
    * \li Supports implementations optimized for memory (\a epk = \a
-   *     EPK_MEMORY, default) and speed (\a epk = \a EPK_SPEED).
+   *     EPK_MEMORY, default) and speed (\a epk = \a EPK_SPEED), and an
+   *     implementation based on bitsets of valid tuples (\a epk = \a
+   *     EPK_COMPACT) that is best suited for large tuple sets.
    * \li Supports domain consistency (\a icl = ICL_DOM, default) only.
    * \li Throws an exception of type Int::ArgumentSizeMismatch, if
    *     \a x and \a t are of different size.
@@ -1902,7 +1967,10 @@ namespace Gecode {
    * O\left(|x|\cdot\min_i(\underline{x_i})\cdot\max_i(\overline{x_i})\right)\f$
    * for the basic algorithm (\a epk = \a EPK_MEMORY) and additionally \f$
    * O\left(|x|^2\cdot\min_i(\underline{x_i})\cdot\max_i(\overline{x_i})\right)\f$
-   * for the incremental algorithm (\a epk = \a EPK_SPEED).
+   * for the incremental algorithm (\a epk = \a EPK_SPEED). The
+   * compact algorithm (\a epk = \a EPK_COMPACT) requires a bitset
+   * of all tuples for each variable and value (stored with the tuple
+   * set and shared by all propagators).
    */
   GECODE_INT_EXPORT void
   extensional(Home home, const IntVarArgs& x, const TupleSet& t,
@@ -1911,7 +1979,9 @@ namespace Gecode {
   /** \brief Post propagator for \f$x\in t\f$.
    *
    * \li Supports implementations optimized for memory (\a epk = \a
-   *     EPK_MEMORY, default) and speed (\a epk = \a EPK_SPEED).
+   *     EPK_MEMORY, default) and speed (\a epk = \a EPK_SPEED), and an
+   *     implementation based on bitsets of valid tuples (\a epk = \a
+   *     EPK_COMPACT) that is best suited for large tuple sets.
    * \li Supports domain consistency (\a icl = ICL_DOM, default) only.
    * \li Throws an exception of type Int::ArgumentSizeMismatch, if
    *     \a x and \a t are of different size.
@@ -2665,6 +2735,11 @@ namespace Gecode {
    * resources in O(kn log n). In I. P. Gent, editor, CP, volume 5732 of LNCS, 
    * pages 802-816. Springer, 2009.
    *
+   * If \a icl is ICL_DOM, the propagator additionally performs
+   * time-table edge-finding, which includes an energetic overload
+   * check on all task intervals. It is stronger for instances with
+   * many tasks that have compulsory parts, but takes quadratic time.
+   *
    *  - Throws an exception of type Int::ArgumentSizeMismatch, if \a t, \a s 
    *    \a p, or \a u are of different size.
    *  - Throws an exception of type Int::OutOfLimits, if \a p, \a u, or \a c
@@ -2716,6 +2791,11 @@ namespace Gecode {
    * resources in O(kn log n). In I. P. Gent, editor, CP, volume 5732 of LNCS, 
    * pages 802-816. Springer, 2009.
    *
+   * If \a icl is ICL_DOM, the propagator additionally performs
+   * time-table edge-finding, which includes an energetic overload
+   * check on all task intervals. It is stronger for instances with
+   * many tasks that have compulsory parts, but takes quadratic time.
+   *
    *  - Throws an exception of type Int::ArgumentSizeMismatch, if \a t, \a s 
    *    \a p, or \a u are of different size.
    *  - Throws an exception of type Int::OutOfLimits, if \a p, \a u, or \a c
@@ -2753,6 +2833,11 @@ namespace Gecode {
    * resources in O(kn log n). In I. P. Gent, editor, CP, volume 5732 of LNCS, 
    * pages 802-816. Springer, 2009.
    *
+   * If \a icl is ICL_DOM, the propagator additionally performs
+   * time-table edge-finding, which includes an energetic overload
+   * check on all task intervals. It is stronger for instances with
+   * many tasks that have compulsory parts, but takes quadratic time.
+   *
    *  - Throws an exception of type Int::ArgumentSizeMismatch, if \a s 
    *    \a p, or \a u are of different size.
    *  - Throws an exception of type Int::OutOfLimits, if \a p, \a u, or \a c
@@ -2790,6 +2875,11 @@ namespace Gecode {
    * resources in O(kn log n). In I. P. Gent, editor, CP, volume 5732 of LNCS, 
    * pages 802-816. Springer, 2009.
    *
+   * If \a icl is ICL_DOM, the propagator additionally performs
+   * time-table edge-finding, which includes an energetic overload
+   * check on all task intervals. It is stronger for instances with
+   * many tasks that have compulsory parts, but takes quadratic time.
+   *
    *  - Throws an exception of type Int::ArgumentSizeMismatch, if \a s,
    *    \a p, \a u, or \a m are of different size.
    *  - Throws an exception of type Int::OutOfLimits, if \a p, \a u, or \a c
@@ -2829,6 +2919,11 @@ namespace Gecode {
    * resources in O(kn log n). In I. P. Gent, editor, CP, volume 5732 of LNCS, 
    * pages 802-816. Springer, 2009.
    *
+   * If \a icl is ICL_DOM, the propagator additionally performs
+   * time-table edge-finding, which includes an energetic overload
+   * check on all task intervals. It is stronger for instances with
+   * many tasks that have compulsory parts, but takes quadratic time.
+   *
    *  - Throws an exception of type Int::ArgumentSizeMismatch, if \a s 
    *    \a p, or \a u are of different size.
    *  - Throws an exception of type Int::OutOfLimits, if \a u or \a c
@@ -2870,6 +2965,11 @@ namespace Gecode {
    * resources in O(kn log n). In I. P. Gent, editor, CP, volume 5732 of LNCS, 
    * pages 802-816. Springer, 2009.
    *
+   * If \a icl is ICL_DOM, the propagator additionally performs
+   * time-table edge-finding, which includes an energetic overload
+   * check on all task intervals. It is stronger for instances with
+   * many tasks that have compulsory parts, but takes quadratic time.
+   *
    *  - Throws an exception of type Int::ArgumentSizeMismatch, if \a s,
    *    \a p, \a u, or \a m are of different size.
    *  - Throws an exception of type Int::OutOfLimits, if \a u or \a c
@@ -3378,6 +3478,47 @@ namespace Gecode {
 
   //@}
 
+  /**
+   * \defgroup TaskModelIntRelax Relaxing solutions
+   *
+   * Relaxing a solution fixes a randomly selected subset of the
+   * variables to their values in the solution. This can be used for
+   * defining neighbourhoods for large neighbourhood search (see
+   * Space::slave).
+   *
+   * \ingroup TaskModelInt
+   */
+  //@{
+  /**
+   * \brief Relax variables in \a x from solution \a sx
+   *
+   * Each variable \f$x_i\f$ is constrained to be equal to the value of
+   * \f$sx_i\f$ with probability \f$1-p\f$, where the random
+   * number generator \a r is used for selecting the variables.
+   *
+   * Throws an exception of type Int::ArgumentSizeMismatch, if \a x
+   * and \a sx are of different size. Throws an exception of type
+   * Int::OutOfLimits, if \a p is not between 0.0 and 1.0.
+   */
+  GECODE_INT_EXPORT void
+  relax(Home home, const IntVarArgs& x, const IntVarArgs& sx,
+        Support::RandomGenerator& r, double p);
+  /**
+   * \brief Relax variables in \a x from solution \a sx
+   *
+   * Each variable \f$x_i\f$ is constrained to be equal to the value of
+   * \f$sx_i\f$ with probability \f$1-p\f$, where the random
+   * number generator \a r is used for selecting the variables.
+   *
+   * Throws an exception of type Int::ArgumentSizeMismatch, if \a x
+   * and \a sx are of different size. Throws an exception of type
+   * Int::OutOfLimits, if \a p is not between 0.0 and 1.0.
+   */
+  GECODE_INT_EXPORT void
+  relax(Home home, const BoolVarArgs& x, const BoolVarArgs& sx,
+        Support::RandomGenerator& r, double p);
+  //@}
+
   /** Print DFA \a d
    * \relates Gecode::DFA
    */
@@ -634,7 +634,8 @@ namespace Gecode {
           NegBoolView nb(x[i]); b[i]=nb;
         }
         b.unique(home);
-        GECODE_ES_FAIL(Bool::NaryOrTrue<NegBoolView>::post(home,b));
+        ViewArray<BoolView> e;
+        GECODE_ES_FAIL(Bool::Clauses::post(home,e,b));
       } else {
         for (int i=m; i--; ) {
           BoolView b(x[i]); GECODE_ME_FAIL(b.one(home));
@@ -649,7 +650,8 @@ namespace Gecode {
       } else {
         ViewArray<BoolView> b(home,x);
         b.unique(home);
-        GECODE_ES_FAIL(Bool::NaryOrTrue<BoolView>::post(home,b));
+        ViewArray<NegBoolView> e;
+        GECODE_ES_FAIL(Bool::Clauses::post(home,b,e));
       }
       break;
     case BOT_IMP:
@@ -709,8 +711,7 @@ namespace Gecode {
         }
         ViewArray<BoolView> yv(home,y);
         xv.unique(home); yv.unique(home);
-        GECODE_ES_FAIL((Bool::ClauseTrue<NegBoolView,BoolView>
-                             ::post(home,xv,yv)));
+        GECODE_ES_FAIL(Bool::Clauses::post(home,yv,xv));
       } else {
         for (int i=x.size(); i--; ) {
           BoolView b(x[i]); GECODE_ME_FAIL(b.one(home));
@@ -735,8 +736,7 @@ namespace Gecode {
           NegBoolView n(y[i]); yv[i]=n;
         }
         xv.unique(home); yv.unique(home);
-        GECODE_ES_FAIL((Bool::ClauseTrue<BoolView,NegBoolView>
-                             ::post(home,xv,yv)));
+        GECODE_ES_FAIL(Bool::Clauses::post(home,xv,yv));
       }
       break;
     default:
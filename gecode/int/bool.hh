@@ -525,6 +525,90 @@ namespace Gecode { namespace Int { namespace Bool {
     virtual size_t dispose(Space& home);
   };
 
+  /**
+   * \brief Database of Boolean clauses with watched literals
+   *
+   * A single propagator per space (see Gecode::UA_CLAUSES) stores all
+   * clauses \f$\bigvee_{i} x_i \vee \bigvee_{j} \neg y_j\f$ posted to
+   * the space. For each clause, two of its literals are watched by
+   * advisors. Only when a watched literal becomes false a new literal
+   * to watch is searched for. If there is none, the clause has become
+   * unit and the remaining watched literal is set to true when the
+   * propagator is executed.
+   *
+   * Requires \code #include <gecode/int/bool.hh> \endcode
+   * \ingroup FuncIntProp
+   */
+  class Clauses : public Propagator {
+  protected:
+    /// %Literal as a view with a sign
+    class Literal {
+    public:
+      /// The view
+      BoolView x;
+      /// Whether the literal is negative
+      bool n;
+      /// Test whether literal is true
+      bool one(void) const;
+      /// Test whether literal is false
+      bool zero(void) const;
+      /// Make literal true
+      ModEvent one(Space& home);
+    };
+    /// %Advisor for a watched literal
+    class Watch : public Advisor {
+    public:
+      /// The clause
+      int c;
+      /// Position of the watched literal in the clause (either 0 or 1)
+      int w;
+      /// Create advisor for position \a w of clause \a c
+      Watch(Space& home, Propagator& p, Council<Watch>& co, int c, int w);
+      /// Clone advisor \a a
+      Watch(Space& home, bool share, Watch& a);
+    };
+    /// The advisor council
+    Council<Watch> co;
+    /// Literals of all clauses (the first two literals are watched)
+    Literal* l;
+    /// Clause \a c has the literals from \a s[c] to \a s[c+1]-1
+    int* s;
+    /// Whether a clause is known to be satisfied
+    bool* sat;
+    /// Clauses that have become unit
+    int* u;
+    /// Number of unit clauses
+    int n_u;
+    /// Number of clauses
+    int n_c;
+    /// Number of clauses for which memory has been allocated
+    int m_c;
+    /// Number of literals for which memory has been allocated
+    int m_l;
+    /// Constructor for creation
+    Clauses(Home home);
+    /// Constructor for cloning \a p
+    Clauses(Space& home, bool share, Clauses& p);
+    /// Add clause with literals \a x and \a y
+    void add(Space& home, ViewArray<BoolView>& x, ViewArray<NegBoolView>& y);
+    /// Record that the clause of \a a is satisfied and dispose \a a
+    ExecStatus satisfied(Space& home, Watch& a);
+  public:
+    /// Copy propagator during cloning
+    virtual Actor* copy(Space& home, bool share);
+    /// Give advice to propagator
+    virtual ExecStatus advise(Space& home, Advisor& a, const Delta& d);
+    /// Cost function (defined as low linear in the number of unit clauses)
+    virtual PropCost cost(const Space& home, const ModEventDelta& med) const;
+    /// Perform propagation
+    virtual ExecStatus propagate(Space& home, const ModEventDelta& med);
+    /// Post clause \f$ \bigvee_{i=0}^{|x|-1} x_i \vee \bigvee_{i=0}^{|y|-1} y_i = 1\f$ to the clause database of \a home
+    static ExecStatus post(Home home,
+                           ViewArray<BoolView>& x, ViewArray<NegBoolView>& y);
+    /// Delete propagator and return its size
+    virtual size_t dispose(Space& home);
+  };
+
 
 }}}
 
@@ -534,6 +618,7 @@ namespace Gecode { namespace Int { namespace Bool {
 #include <gecode/int/bool/or.hpp>
 #include <gecode/int/bool/eqv.hpp>
 #include <gecode/int/bool/clause.hpp>
+#include <gecode/int/bool/clauses.hpp>
 
 #endif
 
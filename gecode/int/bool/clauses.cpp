@@ -0,0 +1,184 @@
+/* -*- mode: C++; c-basic-offset: 2; indent-tabs-mode: nil -*- */
+/*
+ *  Main authors:
+ *     Christian Schulte <schulte@gecode.org>
+ *
+ *  Copyright:
+ *     Christian Schulte, 2011
+ *
+ *  Last modified:
+ *     $Date$ by $Author$
+ *     $Revision$
+ *
+ *  This file is part of Gecode, the generic constraint
+ *  development environment:
+ *     http://www.gecode.org
+ *
+ *  Permission is hereby granted, free of charge, to any person obtaining
+ *  a copy of this software and associated documentation files (the
+ *  "Software"), to deal in the Software without restriction, including
+ *  without limitation the rights to use, copy, modify, merge, publish,
+ *  distribute, sublicense, and/or sell copies of the Software, and to
+ *  permit persons to whom the Software is furnished to do so, subject to
+ *  the following conditions:
+ *
+ *  The above copyright notice and this permission notice shall be
+ *  included in all copies or substantial portions of the Software.
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ *  EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ *  MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ *  NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE
+ *  LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+ *  OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+ *  WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ */
+
+
+#include <gecode/int/bool.hh>
+
+#include <algorithm>
+
+namespace Gecode { namespace Int { namespace Bool {
+
+  /*
+   * The clause database
+   *
+   */
+  Clauses::Clauses(Space& home, bool share, Clauses& p)
+    : Propagator(home,share,p), n_u(0), n_c(p.n_c),
+      m_c(p.n_c), m_l(p.s[p.n_c]) {
+    assert(p.n_u == 0);
+    co.update(home,share,p.co);
+    l = home.alloc<Literal>(m_l);
+    for (int i=m_l; i--; ) {
+      l[i].x.update(home,share,p.l[i].x); l[i].n = p.l[i].n;
+    }
+    s = home.alloc<int>(n_c+1);
+    for (int i=n_c+1; i--; )
+      s[i] = p.s[i];
+    sat = home.alloc<bool>(n_c);
+    for (int i=n_c; i--; )
+      sat[i] = p.sat[i];
+    u = home.alloc<int>(n_c);
+    home.unique(UA_CLAUSES,this);
+  }
+
+  Actor*
+  Clauses::copy(Space& home, bool share) {
+    return new (home) Clauses(home,share,*this);
+  }
+
+  PropCost
+  Clauses::cost(const Space&, const ModEventDelta&) const {
+    return PropCost::linear(PropCost::LO,n_u);
+  }
+
+  forceinline ExecStatus
+  Clauses::satisfied(Space& home, Watch& a) {
+    sat[a.c] = true;
+    a.dispose(home,co);
+    // If all clauses are satisfied the propagator is subsumed
+    return co.empty() ? ES_NOFIX : ES_FIX;
+  }
+
+  ExecStatus
+  Clauses::advise(Space& home, Advisor& _a, const Delta&) {
+    Watch& a = static_cast<Watch&>(_a);
+    int c = a.c;
+    if (sat[c])
+      return satisfied(home,a);
+    Literal* lc = l + s[c];
+    if (lc[a.w].one()) {
+      return satisfied(home,a);
+    }
+    // The watched literal is false, find a new literal to watch
+    for (int i=2; i<s[c+1]-s[c]; i++)
+      if (!lc[i].zero()) {
+        std::swap(lc[a.w],lc[i]);
+        if (lc[a.w].one()) {
+          return satisfied(home,a);
+        }
+        lc[a.w].x.subscribe(home,a);
+        return ES_FIX;
+      }
+    // All literals but the other watched literal are false
+    if (lc[1-a.w].one()) {
+      return satisfied(home,a);
+    }
+    if (lc[1-a.w].zero())
+      return ES_FAILED;
+    // The clause is unit
+    u[n_u++] = c;
+    return home.ES_NOFIX_DISPOSE(co,a);
+  }
+
+  ExecStatus
+  Clauses::propagate(Space& home, const ModEventDelta&) {
+    // Setting literals might make further clauses unit
+    while (n_u > 0) {
+      int c = u[--n_u];
+      if (sat[c])
+        continue;
+      Literal* lc = l + s[c];
+      // Only one of the watched literals can be false
+      GECODE_ME_CHECK(lc[lc[0].zero() ? 1 : 0].one(home));
+      sat[c] = true;
+    }
+    return co.empty() ? home.ES_SUBSUMED(*this) : ES_FIX;
+  }
+
+  size_t
+  Clauses::dispose(Space& home) {
+    for (Advisors<Watch> as(co); as(); ++as)
+      l[s[as.advisor().c]+as.advisor().w].x.cancel(home,as.advisor());
+    co.dispose(home);
+    if (home.unique(UA_CLAUSES) == this)
+      home.unique(UA_CLAUSES,NULL);
+    home.free<Literal>(l,m_l);
+    home.free<int>(s,m_c+1);
+    home.free<bool>(sat,m_c);
+    home.free<int>(u,m_c);
+    (void) Propagator::dispose(home);
+    return sizeof(*this);
+  }
+
+  ExecStatus
+  Clauses::post(Home home, ViewArray<BoolView>& x, ViewArray<NegBoolView>& y) {
+    for (int i=x.size(); i--; )
+      if (x[i].one())
+        return ES_OK;
+      else if (x[i].zero())
+        x.move_lst(i);
+    for (int i=y.size(); i--; )
+      if (y[i].one())
+        return ES_OK;
+      else if (y[i].zero())
+        y.move_lst(i);
+    switch (x.size() + y.size()) {
+    case 0:
+      return ES_FAILED;
+    case 1:
+      if (x.size() == 1)
+        GECODE_ME_CHECK(x[0].one(home));
+      else
+        GECODE_ME_CHECK(y[0].one(home));
+      return ES_OK;
+    default:
+      break;
+    }
+    if (x.shared(home,y))
+      return ES_OK;
+    Clauses* p = static_cast<Clauses*>
+      (static_cast<Space&>(home).unique(UA_CLAUSES));
+    if (p == NULL)
+      p = new (home) Clauses(home);
+    p->add(home,x,y);
+    return ES_OK;
+  }
+
+}}}
+
+// STATISTICS: int-prop
+
@@ -0,0 +1,119 @@
+/* -*- mode: C++; c-basic-offset: 2; indent-tabs-mode: nil -*- */
+/*
+ *  Main authors:
+ *     Christian Schulte <schulte@gecode.org>
+ *
+ *  Copyright:
+ *     Christian Schulte, 2011
+ *
+ *  Last modified:
+ *     $Date$ by $Author$
+ *     $Revision$
+ *
+ *  This file is part of Gecode, the generic constraint
+ *  development environment:
+ *     http://www.gecode.org
+ *
+ *  Permission is hereby granted, free of charge, to any person obtaining
+ *  a copy of this software and associated documentation files (the
+ *  "Software"), to deal in the Software without restriction, including
+ *  without limitation the rights to use, copy, modify, merge, publish,
+ *  distribute, sublicense, and/or sell copies of the Software, and to
+ *  permit persons to whom the Software is furnished to do so, subject to
+ *  the following conditions:
+ *
+ *  The above copyright notice and this permission notice shall be
+ *  included in all copies or substantial portions of the Software.
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ *  EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ *  MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ *  NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE
+ *  LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+ *  OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+ *  WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ */
+
+
+namespace Gecode { namespace Int { namespace Bool {
+
+  /*
+   * Literals
+   *
+   */
+  forceinline bool
+  Clauses::Literal::one(void) const {
+    return n ? x.zero() : x.one();
+  }
+  forceinline bool
+  Clauses::Literal::zero(void) const {
+    return n ? x.one() : x.zero();
+  }
+  forceinline ModEvent
+  Clauses::Literal::one(Space& home) {
+    return n ? x.zero(home) : x.one(home);
+  }
+
+
+  /*
+   * Advisors
+   *
+   */
+  forceinline
+  Clauses::Watch::Watch(Space& home, Propagator& p,
+                        Council<Watch>& co, int c0, int w0)
+    : Advisor(home,p,co), c(c0), w(w0) {}
+  forceinline
+  Clauses::Watch::Watch(Space& home, bool share, Watch& a)
+    : Advisor(home,share,a), c(a.c), w(a.w) {}
+
+
+  /*
+   * The clause database
+   *
+   */
+  forceinline
+  Clauses::Clauses(Home home)
+    : Propagator(home), co(home), l(NULL), s(NULL), sat(NULL), u(NULL),
+      n_u(0), n_c(0), m_c(0), m_l(0) {
+    s = static_cast<Space&>(home).alloc<int>(1);
+    s[0] = 0;
+    static_cast<Space&>(home).unique(UA_CLAUSES,this);
+  }
+
+  forceinline void
+  Clauses::add(Space& home, ViewArray<BoolView>& x, ViewArray<NegBoolView>& y) {
+    int n_l = s[n_c];
+    if (n_c == m_c) {
+      int m = (m_c == 0) ? 4 : 2*m_c;
+      s = home.realloc<int>(s,m_c+1,m+1);
+      sat = home.realloc<bool>(sat,m_c,m);
+      u = home.realloc<int>(u,m_c,m);
+      m_c = m;
+    }
+    if (n_l + x.size() + y.size() > m_l) {
+      int m = 2*m_l;
+      if (m < n_l + x.size() + y.size())
+        m = n_l + x.size() + y.size();
+      l = home.realloc<Literal>(l,m_l,m);
+      m_l = m;
+    }
+    for (int i=0; i<x.size(); i++) {
+      l[n_l].x = x[i]; l[n_l].n = false; n_l++;
+    }
+    for (int i=0; i<y.size(); i++) {
+      l[n_l].x = y[i].base(); l[n_l].n = true; n_l++;
+    }
+    sat[n_c] = false;
+    s[n_c+1] = n_l;
+    // Watch the first two literals
+    l[s[n_c]].x.subscribe(home,*new (home) Watch(home,*this,co,n_c,0));
+    l[s[n_c]+1].x.subscribe(home,*new (home) Watch(home,*this,co,n_c,1));
+    n_c++;
+  }
+
+}}}
+
+// STATISTICS: int-prop
+
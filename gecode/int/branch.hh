@@ -47,6 +47,122 @@
 
 namespace Gecode { namespace Int { namespace Branch {
 
+  /*
+   * No-good literals
+   *
+   */
+
+  /// No-good literal for equality \f$x=n\f$
+  template<class View>
+  class EqNGL : public ViewNGL<View,PC_INT_DOM> {
+  protected:
+    using ViewNGL<View,PC_INT_DOM>::x;
+    /// The value
+    int n;
+  public:
+    /// Constructor for creation
+    EqNGL(Space& home, View x, int n);
+    /// Constructor for cloning \a ngl
+    EqNGL(Space& home, bool share, EqNGL& ngl);
+    /// Test the status of the literal
+    virtual NGL::Status status(const Space& home) const;
+    /// Propagate the negation of the literal
+    virtual ExecStatus prune(Space& home);
+    /// Create copy
+    virtual NGL* copy(Space& home, bool share);
+    /// Dispose literal and return its size
+    virtual size_t dispose(Space& home);
+  };
+
+  /// No-good literal for Boolean equality \f$x=n\f$ with \f$n\in\{0,1\}\f$
+  template<class View>
+  class BoolEqNGL : public ViewNGL<View,PC_BOOL_VAL> {
+  protected:
+    using ViewNGL<View,PC_BOOL_VAL>::x;
+    /// The value
+    int n;
+  public:
+    /// Constructor for creation
+    BoolEqNGL(Space& home, View x, int n);
+    /// Constructor for cloning \a ngl
+    BoolEqNGL(Space& home, bool share, BoolEqNGL& ngl);
+    /// Test the status of the literal
+    virtual NGL::Status status(const Space& home) const;
+    /// Propagate the negation of the literal
+    virtual ExecStatus prune(Space& home);
+    /// Create copy
+    virtual NGL* copy(Space& home, bool share);
+    /// Dispose literal and return its size
+    virtual size_t dispose(Space& home);
+  };
+
+  /// No-good literal for disequality \f$x\neq n\f$
+  template<class View>
+  class NqNGL : public ViewNGL<View,PC_INT_DOM> {
+  protected:
+    using ViewNGL<View,PC_INT_DOM>::x;
+    /// The value
+    int n;
+  public:
+    /// Constructor for creation
+    NqNGL(Space& home, View x, int n);
+    /// Constructor for cloning \a ngl
+    NqNGL(Space& home, bool share, NqNGL& ngl);
+    /// Test the status of the literal
+    virtual NGL::Status status(const Space& home) const;
+    /// Propagate the negation of the literal
+    virtual ExecStatus prune(Space& home);
+    /// Create copy
+    virtual NGL* copy(Space& home, bool share);
+    /// Dispose literal and return its size
+    virtual size_t dispose(Space& home);
+  };
+
+  /// No-good literal for less or equal \f$x\leq n\f$
+  template<class View>
+  class LqNGL : public ViewNGL<View,PC_INT_BND> {
+  protected:
+    using ViewNGL<View,PC_INT_BND>::x;
+    /// The value
+    int n;
+  public:
+    /// Constructor for creation
+    LqNGL(Space& home, View x, int n);
+    /// Constructor for cloning \a ngl
+    LqNGL(Space& home, bool share, LqNGL& ngl);
+    /// Test the status of the literal
+    virtual NGL::Status status(const Space& home) const;
+    /// Propagate the negation of the literal
+    virtual ExecStatus prune(Space& home);
+    /// Create copy
+    virtual NGL* copy(Space& home, bool share);
+    /// Dispose literal and return its size
+    virtual size_t dispose(Space& home);
+  };
+
+  /// No-good literal for greater \f$x>n\f$
+  template<class View>
+  class GrNGL : public ViewNGL<View,PC_INT_BND> {
+  protected:
+    using ViewNGL<View,PC_INT_BND>::x;
+    /// The value
+    int n;
+  public:
+    /// Constructor for creation
+    GrNGL(Space& home, View x, int n);
+    /// Constructor for cloning \a ngl
+    GrNGL(Space& home, bool share, GrNGL& ngl);
+    /// Test the status of the literal
+    virtual NGL::Status status(const Space& home) const;
+    /// Propagate the negation of the literal
+    virtual ExecStatus prune(Space& home);
+    /// Create copy
+    virtual NGL* copy(Space& home, bool share);
+    /// Dispose literal and return its size
+    virtual size_t dispose(Space& home);
+  };
+
+
   /*
    * Value selection classes
    *
@@ -70,6 +186,8 @@ namespace Gecode { namespace Int { namespace Branch {
     int val(Space& home, View x) const;
     /// Tell \f$x=n\f$ (\a a = 0) or \f$x\neq n\f$ (\a a = 1)
     ModEvent tell(Space& home, unsigned int a, View x, int n);
+    /// Return no-good literal for \f$x=n\f$ (\a a = 0) or \f$x>n\f$ (\a a = 1)
+    NGL* ngl(Space& home, unsigned int a, View x, int n) const;
   };
 
   /**
@@ -90,6 +208,8 @@ namespace Gecode { namespace Int { namespace Branch {
     int val(Space& home, View x) const;
     /// Tell \f$x=n\f$ (\a a = 0) or \f$x\neq n\f$ (\a a = 1)
     ModEvent tell(Space& home, unsigned int a, View x, int n);
+    /// Return no-good literal for \f$x=n\f$ (\a a = 0) or \f$x\neq n\f$ (\a a = 1)
+    NGL* ngl(Space& home, unsigned int a, View x, int n) const;
   };
 
   /**
@@ -121,6 +241,8 @@ namespace Gecode { namespace Int { namespace Branch {
     int val(Space& home, _View x);
     /// Tell \f$x\leq n\f$ (\a a = 0) or \f$x\neq n\f$ (\a a = 1)
     ModEvent tell(Space& home, unsigned int a, _View x, int n);
+    /// Return no-good literal for \f$x=n\f$ (\a a = 0) or \f$x\neq n\f$ (\a a = 1)
+    NGL* ngl(Space& home, unsigned int a, _View x, int n) const;
     /// Return choice
     Choice choice(Space& home);
     /// Return choice
@@ -152,6 +274,8 @@ namespace Gecode { namespace Int { namespace Branch {
     int val(Space& home, View x) const;
     /// Tell \f$x\leq n\f$ (\a a = 0) or \f$x >n\f$ (\a a = 1)
     ModEvent tell(Space& home, unsigned int a, View x, int n);
+    /// Return no-good literal for \f$x\leq n\f$ (\a a = 0) or \f$x>n\f$ (\a a = 1)
+    NGL* ngl(Space& home, unsigned int a, View x, int n) const;
   };
 
 
@@ -174,6 +298,8 @@ namespace Gecode { namespace Int { namespace Branch {
     int val(Space& home, View x) const;
     /// Tell \f$x\leq n\f$ (\a a = 0) or \f$x >n\f$ (\a a = 1)
     ModEvent tell(Space& home, unsigned int a, View x, int n);
+    /// Return no-good literal for \f$x\leq n\f$ (\a a = 0) or \f$x>n\f$ (\a a = 1)
+    NGL* ngl(Space& home, unsigned int a, View x, int n) const;
   };
 
 
@@ -213,6 +339,8 @@ namespace Gecode { namespace Int { namespace Branch {
     NoValue val(Space& home, View x) const;
     /// Tell \f$x=0\f$ (\a a = 0) or \f$x=1\f$ (\a a = 1)
     ModEvent tell(Space& home, unsigned int a, View x, NoValue n);
+    /// Return no-good literal for \f$x=0\f$ (\a a = 0) or \f$x=1\f$ (\a a = 1)
+    NGL* ngl(Space& home, unsigned int a, View x, NoValue n) const;
   };
 
 
@@ -596,6 +724,7 @@ namespace Gecode { namespace Int { namespace Branch {
 
 }}}
 
+#include <gecode/int/branch/ngl.hpp>
 #include <gecode/int/branch/select-val.hpp>
 #include <gecode/int/branch/select-values.hpp>
 #include <gecode/int/branch/select-view.hpp>
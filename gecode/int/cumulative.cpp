@@ -91,12 +91,12 @@ namespace Gecode {
         TaskArray<ManFixPTask> tasks(home,s.size());
         for (int i=0; i<s.size(); i++)
           tasks[i].init(s[i],p[i],u[i]);
-        GECODE_ES_FAIL((ManProp<ManFixPTask,Cap>::post(home,c,tasks)));
+        GECODE_ES_FAIL((ManProp<ManFixPTask,Cap>::post(home,c,tasks,icl==ICL_DOM)));
       } else {
         TaskArray<ManFixPSETask> tasks(home,s.size());
         for (int i=s.size(); i--;)
           tasks[i].init(t[i],s[i],p[i],u[i]);
-        GECODE_ES_FAIL((ManProp<ManFixPSETask,Cap>::post(home,c,tasks)));
+        GECODE_ES_FAIL((ManProp<ManFixPSETask,Cap>::post(home,c,tasks,icl==ICL_DOM)));
       }
     }
   }
@@ -161,12 +161,12 @@ namespace Gecode {
         TaskArray<OptFixPTask> tasks(home,s.size());
         for (int i=0; i<s.size(); i++)
           tasks[i].init(s[i],p[i],u[i],m[i]);
-        GECODE_ES_FAIL((OptProp<OptFixPTask,Cap>::post(home,c,tasks)));
+        GECODE_ES_FAIL((OptProp<OptFixPTask,Cap>::post(home,c,tasks,icl==ICL_DOM)));
       } else {
         TaskArray<OptFixPSETask> tasks(home,s.size());
         for (int i=s.size(); i--;)
           tasks[i].init(t[i],s[i],p[i],u[i],m[i]);
-        GECODE_ES_FAIL((OptProp<OptFixPSETask,Cap>::post(home,c,tasks)));
+        GECODE_ES_FAIL((OptProp<OptFixPSETask,Cap>::post(home,c,tasks,icl==ICL_DOM)));
       }
     }
   }
@@ -229,7 +229,7 @@ namespace Gecode {
       for (int i=0; i<s.size(); i++) {
         t[i].init(s[i],p[i],u[i]);
       }
-      GECODE_ES_FAIL((ManProp<ManFixPTask,Cap>::post(home,c,t)));
+      GECODE_ES_FAIL((ManProp<ManFixPTask,Cap>::post(home,c,t,icl==ICL_DOM)));
     }
   }
 
@@ -285,7 +285,7 @@ namespace Gecode {
       for (int i=0; i<s.size(); i++) {
         t[i].init(s[i],p[i],u[i],m[i]);
       }
-      GECODE_ES_FAIL((OptProp<OptFixPTask,Cap>::post(home,c,t)));
+      GECODE_ES_FAIL((OptProp<OptFixPTask,Cap>::post(home,c,t,icl==ICL_DOM)));
     }
   }
 
@@ -346,7 +346,7 @@ namespace Gecode {
       TaskArray<ManFlexTask> t(home,s.size());
       for (int i=s.size(); i--; )
         t[i].init(s[i],p[i],e[i],u[i]);
-      GECODE_ES_FAIL((ManProp<ManFlexTask,Cap>::post(home,c,t)));
+      GECODE_ES_FAIL((ManProp<ManFlexTask,Cap>::post(home,c,t,icl==ICL_DOM)));
     }
   }
 
@@ -406,7 +406,7 @@ namespace Gecode {
       TaskArray<OptFlexTask> t(home,s.size());
       for (int i=s.size(); i--; )
         t[i].init(s[i],p[i],e[i],u[i],m[i]);
-      GECODE_ES_FAIL((OptProp<OptFlexTask,Cap>::post(home,c,t)));
+      GECODE_ES_FAIL((OptProp<OptFlexTask,Cap>::post(home,c,t,icl==ICL_DOM)));
     }
   }
 
@@ -53,6 +53,13 @@
  *   Petr Vilm, Edge Finding Filtering Algorithm for Discrete
  *   Cumulative Resources in O(kn log n), CP, 2009.
  *
+ * The time-table edge-finding algorithm follows:
+ *   Petr Vilm, Timetable Edge Finding Filtering Algorithm for
+ *   Discrete Cumulative Resources, CPAIOR, 2011.
+ *   Andreas Schutt, Thibaut Feydy, Peter J. Stuckey, Explaining
+ *   Time-Table-Edge-Finding Propagation for the Cumulative Resource
+ *   Constraint, CPAIOR, 2013.
+ *
  * \brief %Scheduling for cumulative resources
  */
 
@@ -666,9 +673,48 @@ namespace Gecode { namespace Int { namespace Cumulative {
 
 namespace Gecode { namespace Int { namespace Cumulative {
 
-  /// Perform basic propagation
+  /**
+   * \brief %Advisor for the compulsory part of a task
+   *
+   * The advisor keeps a copy of its task and records the compulsory
+   * part of the task in the profile of its propagator whenever the
+   * task is modified.
+   */
+  template<class Task>
+  class ProfileAdvisor : public Advisor {
+  protected:
+    /// The task
+    Task t;
+    /// The item of the task in the profile
+    int i;
+  public:
+    /// Create advisor for task \a t0 with item \a i0
+    ProfileAdvisor(Space& home, Propagator& p,
+                   Council<ProfileAdvisor<Task> >& c,
+                   const Task& t0, int i0);
+    /// Clone advisor \a a
+    ProfileAdvisor(Space& home, bool share, ProfileAdvisor<Task>& a);
+    /// Record compulsory part of task in profile \a cp
+    void profile(Profile& cp) const;
+    /// Whether the compulsory part of the task cannot change anymore
+    bool fixed(void) const;
+    /// Delete advisor
+    void dispose(Space& home, Council<ProfileAdvisor<Task> >& c);
+  };
+
+  /// Record compulsory part of task \a t as item \a i in profile \a cp
+  template<class Task>
+  void compulsory(Profile& cp, int i, const Task& t);
+
+  /**
+   * \brief Perform basic propagation
+   *
+   * The propagation uses the profile \a cp of the compulsory parts of
+   * the tasks \a t, where the profile is maintained by advisors.
+   */
   template<class Task, class Cap>
-  ExecStatus basic(Space& home, bool& subsumed, Cap c, TaskArray<Task>& t);
+  ExecStatus basic(Space& home, bool& subsumed, Cap c, TaskArray<Task>& t,
+                   Profile& cp);
 
   /// Check mandatory tasks \a t for overload
   template<class ManTask>
@@ -678,6 +724,17 @@ namespace Gecode { namespace Int { namespace Cumulative {
   template<class Task>
   ExecStatus edgefinding(Space& home, int c, TaskArray<Task>& t);
 
+  /**
+   * \brief Propagate by time-table edge finding
+   *
+   * Combines the energy of the tasks contained in a task interval with
+   * the energy of the compulsory parts of all other tasks in the
+   * interval. This includes an energetic overload check on all task
+   * intervals.
+   */
+  template<class Task>
+  ExecStatus ttedgefinding(Space& home, int c, TaskArray<Task>& t);
+
   /**
    * \brief Scheduling propagator for cumulative resource with mandatory tasks
    *
@@ -690,17 +747,30 @@ namespace Gecode { namespace Int { namespace Cumulative {
     using TaskProp<ManTask,Int::PC_INT_DOM>::t;
     /// Resource capacity
     Cap c;
+    /// Whether to use time-table edge finding
+    bool ttef;
+    /// Profile of compulsory parts
+    Profile cp;
+    /// Advisors for maintaining the profile
+    Council<ProfileAdvisor<ManTask> > ca;
     /// Constructor for creation
-    ManProp(Home home, Cap c, TaskArray<ManTask>& t);
+    ManProp(Home home, Cap c, TaskArray<ManTask>& t, bool ttef);
     /// Constructor for cloning \a p
     ManProp(Space& home, bool shared, ManProp& p);
   public:
     /// Perform copying during cloning
     virtual Actor* copy(Space& home, bool share);
+    /// Give advice to propagator
+    virtual ExecStatus advise(Space& home, Advisor& a, const Delta& d);
     /// Perform propagation
     virtual ExecStatus propagate(Space& home, const ModEventDelta& med);
-    /// Post propagator that schedules tasks on cumulative resource
-    static ExecStatus post(Home home, Cap c, TaskArray<ManTask>& t);
+    /**
+     * \brief Post propagator that schedules tasks on cumulative resource
+     *
+     * If \a ttef is true, also time-table edge finding is performed.
+     */
+    static ExecStatus post(Home home, Cap c, TaskArray<ManTask>& t,
+                           bool ttef=false);
     /// Delete propagator and return its size
     virtual size_t dispose(Space& home);
   };
@@ -717,17 +787,30 @@ namespace Gecode { namespace Int { namespace Cumulative {
     using TaskProp<OptTask,Int::PC_INT_DOM>::t;
     /// Resource capacity
     Cap c;
+    /// Whether to use time-table edge finding
+    bool ttef;
+    /// Profile of compulsory parts
+    Profile cp;
+    /// Advisors for maintaining the profile
+    Council<ProfileAdvisor<OptTask> > ca;
     /// Constructor for creation
-    OptProp(Home home, Cap c, TaskArray<OptTask>& t);
+    OptProp(Home home, Cap c, TaskArray<OptTask>& t, bool ttef);
     /// Constructor for cloning \a p
     OptProp(Space& home, bool shared, OptProp& p);
   public:
     /// Perform copying during cloning
     virtual Actor* copy(Space& home, bool share);
+    /// Give advice to propagator
+    virtual ExecStatus advise(Space& home, Advisor& a, const Delta& d);
     /// Perform propagation
     virtual ExecStatus propagate(Space& home, const ModEventDelta& med);
-    /// Post propagator that schedules tasks on cumulative resource
-    static ExecStatus post(Home home, Cap c, TaskArray<OptTask>& t);
+    /**
+     * \brief Post propagator that schedules tasks on cumulative resource
+     *
+     * If \a ttef is true, also time-table edge finding is performed.
+     */
+    static ExecStatus post(Home home, Cap c, TaskArray<OptTask>& t,
+                           bool ttef=false);
     /// Delete propagator and return its size
     virtual size_t dispose(Space& home);
   };
@@ -737,6 +820,7 @@ namespace Gecode { namespace Int { namespace Cumulative {
 #include <gecode/int/cumulative/basic.hpp>
 #include <gecode/int/cumulative/overload.hpp>
 #include <gecode/int/cumulative/edge-finding.hpp>
+#include <gecode/int/cumulative/tt-edge-finding.hpp>
 #include <gecode/int/cumulative/man-prop.hpp>
 #include <gecode/int/cumulative/opt-prop.hpp>
 
@@ -37,170 +37,283 @@
  *
  */
 
+#include <algorithm>
+
 namespace Gecode { namespace Int { namespace Cumulative {
 
-  /// Event for task
-  class Event {
-  public:
-    /// Event type for task with order in which they are processed
-    enum Type {
-      LRT = 0, ///< Latest required time of task
-      LCT = 1, ///< Latest completion time of task
-      EST = 2, ///< Earliest start time of task
-      ZRO = 3, ///< Zero-length task start time
-      ERT = 4, ///< Earliest required time of task
-      END = 5  ///< End marker
-    };
-    Type e; ///< Type of event
-    int t;  ///< Time of event
-    int i;  ///< Number of task
-    /// Initialize event
-    void init(Type e, int t, int i);
-    /// Order among events
-    bool operator <(const Event& e) const;
-  };
+  /*
+   * Advisor for compulsory parts
+   *
+   */
+  template<class Task>
+  forceinline void
+  compulsory(Profile& cp, int i, const Task& t) {
+    if (t.mandatory() && (t.lst() < t.ect()))
+      cp.set(i,t.lst(),t.ect(),t.c());
+    else
+      cp.empty(i);
+  }
 
-  /// Sort order for tasks by decreasing capacity
   template<class Task>
-  class TaskByDecCap {
-  public:
-    /// Sort order
-    bool operator ()(const Task& t1, const Task& t2) const;
-  };
+  forceinline
+  ProfileAdvisor<Task>::ProfileAdvisor(Space& home, Propagator& p,
+                                       Council<ProfileAdvisor<Task> >& c,
+                                       const Task& t0, int i0)
+    : Advisor(home,p,c), t(t0), i(i0) {
+    t.subscribe(home,*this);
+  }
+
+  template<class Task>
+  forceinline
+  ProfileAdvisor<Task>::ProfileAdvisor(Space& home, bool share,
+                                       ProfileAdvisor<Task>& a)
+    : Advisor(home,share,a), i(a.i) {
+    t.update(home,share,a.t);
+  }
 
+  template<class Task>
   forceinline void
-  Event::init(Event::Type e0, int t0, int i0) {
-    e=e0; t=t0; i=i0;
+  ProfileAdvisor<Task>::profile(Profile& cp) const {
+    compulsory(cp,i,t);
   }
 
+  template<class Task>
   forceinline bool
-  Event::operator <(const Event& e) const {
-    if (this->t == e.t)
-      return this->e < e.e;
-    return this->t < e.t;
+  ProfileAdvisor<Task>::fixed(void) const {
+    return t.assigned() || t.excluded();
   }
 
   template<class Task>
-  forceinline bool
-  TaskByDecCap<Task>::operator ()(const Task& t1, const Task& t2) const {
-    return t1.c() > t2.c();
+  forceinline void
+  ProfileAdvisor<Task>::dispose(Space& home,
+                                Council<ProfileAdvisor<Task> >& c) {
+    t.cancel(home,*this);
+    Advisor::dispose(home,c);
+  }
+
+
+  /**
+   * \brief Segments of a profile
+   *
+   * The segments partition the time line such that the height of the
+   * profile does not change within a segment. A balanced binary tree
+   * over the heights of the segments allows to find the next segment
+   * exceeding a given height in logarithmic time.
+   */
+  class TimeTable {
+  protected:
+    /// Number of segments
+    int n;
+    /// Start times of segments (the last entry is infinity)
+    int* st;
+    /// Heights of segments
+    int* h;
+    /// Increase of height at the start of segments
+    int* inc;
+    /// Number of leaves of the tree
+    int l;
+    /// Maximal heights of nodes of the tree
+    int* mh;
+  public:
+    /// Initialize from the events of profile \a cp
+    TimeTable(Region& r, const Profile& cp);
+    /// Return start time of segment \a k
+    int start(int k) const;
+    /// Return height of segment \a k
+    int height(int k) const;
+    /// Return increase of height at start of segment \a k
+    int increase(int k) const;
+    /// Return maximal height
+    int max(void) const;
+    /// Return segment that contains time \a t
+    int find(int t) const;
+    /// Return first segment from segment \a k with height larger than \a x
+    int next(int k, int x) const;
+  };
+
+  forceinline
+  TimeTable::TimeTable(Region& r, const Profile& cp) {
+    int m = cp.events();
+    st = r.alloc<int>(m+2);
+    h = r.alloc<int>(m+1);
+    inc = r.alloc<int>(m+1);
+    // The first segment has height zero
+    st[0] = -Int::Limits::infinity; h[0] = 0; inc[0] = 0;
+    n = 1;
+    int height = 0;
+    for (int k=0; k<m; ) {
+      int t = cp.time(k);
+      int up = 0;
+      for ( ; (k < m) && (cp.time(k) == t); k++) {
+        int d = cp.height(k);
+        height += d;
+        if (d > 0)
+          up += d;
+      }
+      st[n] = t; h[n] = height; inc[n] = up; n++;
+    }
+    st[n] = Int::Limits::infinity;
+    // Initialize tree
+    l = 1;
+    while (l < n)
+      l <<= 1;
+    mh = r.alloc<int>(2*l);
+    for (int k=0; k<n; k++)
+      mh[l+k] = h[k];
+    for (int k=n; k<l; k++)
+      mh[l+k] = -Int::Limits::infinity;
+    for (int k=l; --k > 0; )
+      mh[k] = std::max(mh[2*k],mh[2*k+1]);
+  }
+
+  forceinline int
+  TimeTable::start(int k) const {
+    return st[k];
   }
 
+  forceinline int
+  TimeTable::height(int k) const {
+    return h[k];
+  }
+
+  forceinline int
+  TimeTable::increase(int k) const {
+    return inc[k];
+  }
+
+  forceinline int
+  TimeTable::max(void) const {
+    return mh[1];
+  }
+
+  forceinline int
+  TimeTable::find(int t) const {
+    int lo = 0, hi = n-1;
+    while (lo < hi) {
+      int m = lo + (hi - lo + 1) / 2;
+      if (st[m] <= t)
+        lo = m;
+      else
+        hi = m-1;
+    }
+    return lo;
+  }
+
+  forceinline int
+  TimeTable::next(int k, int x) const {
+    if (k >= n)
+      return n;
+    int v = l+k;
+    while (mh[v] <= x) {
+      // Move to the next subtree to the right
+      while ((v & 1) != 0) {
+        if (v == 1)
+          return n;
+        v >>= 1;
+      }
+      v++;
+    }
+    // Descend to leftmost leaf exceeding x
+    while (v < l) {
+      v <<= 1;
+      if (mh[v] <= x)
+        v++;
+    }
+    return v-l;
+  }
+
+
+  /// Prune task \a t such that it does not run in a segment from \a b to \a e - 1 with height larger than \a x
+  template<class Task>
+  forceinline ExecStatus
+  timetable(Space& home, const TimeTable& tt, Task& t, int b, int e, int x) {
+    if (b >= e)
+      return ES_OK;
+    for (int k=tt.next(tt.find(b),x); tt.start(k) < e; k=tt.next(k+1,x)) {
+      int f = std::max(b,tt.start(k));
+      int l = std::min(e,tt.start(k+1));
+      if (t.pmin() > 0) {
+        GECODE_ME_CHECK(t.norun(home, f, l-1));
+      } else {
+        // Zero-length tasks can run when other tasks start
+        if ((f == tt.start(k)) && (tt.increase(k) > 0))
+          f++;
+        GECODE_ME_CHECK(t.norun(home, f, l-1));
+      }
+    }
+    return ES_OK;
+  }
 
   // Basic propagation
   template<class Task, class Cap>
   ExecStatus
-  basic(Space& home, bool& subsumed, Cap c, TaskArray<Task>& t) {
+  basic(Space& home, bool& subsumed, Cap c, TaskArray<Task>& t,
+        Profile& cp) {
     subsumed = false;
-    int ccur = c.max();
-    int cmax = ccur;
-    int cmin = ccur;
-    // Sort tasks by decreasing capacity
-    TaskByDecCap<Task> tbdc;
-    Support::quicksort(&t[0], t.size(), tbdc);
-
-    Region r(home);
+    // Update profile for tasks modified since last propagation
+    cp.sync(home);
 
-    Event* e = r.alloc<Event>(4*t.size()+1);
-
-    // Initialize events
-    bool assigned=true;
-    {
-      bool required=false;
-      int n=0;
-      for (int i=t.size(); i--; ) 
-        if (t[i].assigned()) {
-          // Only add required part
-          if (t[i].pmin() > 0) {
-            required = true;
-            e[n++].init(Event::ERT,t[i].lst(),i);
-            e[n++].init(Event::LRT,t[i].ect(),i);
-          } else if (t[i].pmax() == 0) {
-            required = true;
-            e[n++].init(Event::ZRO,t[i].lst(),i);
-          }
-        } else {
-          assigned = false;
-          e[n++].init(Event::EST,t[i].est(),i);
-          e[n++].init(Event::LCT,t[i].lct(),i);
-          // Check whether task has required part
-          if (t[i].lst() < t[i].ect()) {
-            required = true;
-            e[n++].init(Event::ERT,t[i].lst(),i);
-            e[n++].init(Event::LRT,t[i].ect(),i);
-          }
-        }
-      
-      // Check whether no task has a required part
-      if (!required) {
-        subsumed = assigned;
-        return ES_FIX;
+    bool assigned=true, zero=false;
+    for (int i=t.size(); i--; )
+      if (t[i].assigned()) {
+        if (t[i].mandatory() && (t[i].pmax() == 0))
+          zero = true;
+      } else {
+        assigned = false;
       }
-      
-      // Write end marker
-      e[n++].init(Event::END,Int::Limits::infinity,-1);
-      
-      // Sort events
-      Support::quicksort(e, n);
+
+    // Check whether no task has a required part
+    if ((cp.events() == 0) && !zero) {
+      subsumed = assigned;
+      return ES_FIX;
     }
 
-    // Set of current but not required tasks
-    Support::BitSet<Region> tasks(r,static_cast<unsigned int>(t.size()));
+    Region r(home);
+    TimeTable tt(r,cp);
 
-    // Process events, use ccur as the capacity that is still free
-    while (e->e != Event::END) {
-      // Current time
-      int time = e->t;
+    int cmax = c.max();
+    // Required capacity
+    int creq = tt.max();
+    if (creq > cmax)
+      return ES_FAILED;
 
-      // Process events for completion of required part
-      for ( ; (e->t == time) && (e->e == Event::LRT); e++) 
-        if (t[e->i].mandatory()) {
-          tasks.set(static_cast<unsigned int>(e->i)); ccur += t[e->i].c();
+    // Check zero-length tasks
+    if (zero)
+      for (int i=t.size(); i--; )
+        if (t[i].assigned() && t[i].mandatory() && (t[i].pmax() == 0)) {
+          int k = tt.find(t[i].lst());
+          // Tasks starting at the same time do not overlap
+          int ck = tt.height(k) + t[i].c();
+          if (tt.start(k) == t[i].lst())
+            ck -= tt.increase(k);
+          if (ck > cmax)
+            return ES_FAILED;
+          creq = std::max(creq,ck);
         }
-      // Process events for completion of task
-      for ( ; (e->t == time) && (e->e == Event::LCT); e++)
-        tasks.clear(static_cast<unsigned int>(e->i));
-      // Process events for start of task
-      for ( ; (e->t == time) && (e->e == Event::EST); e++)
-        tasks.set(static_cast<unsigned int>(e->i));
-      // Process events for zero-length task
-      for ( ; (e->t == time) && (e->e == Event::ZRO); e++) {
-        ccur -= t[e->i].c();
-        if (ccur < cmin) cmin=ccur;
-        if (ccur < 0)
-          return ES_FAILED;
-        ccur += t[e->i].c();
-      }
 
-      // norun start time for 0-length tasks
-      int zltime = time;
-      // Process events for start of required part
-      for ( ; (e->t == time) && (e->e == Event::ERT); e++) 
-        if (t[e->i].mandatory()) {
-          tasks.clear(static_cast<unsigned int>(e->i)); 
-          ccur -= t[e->i].c();
-          if (ccur < cmin) cmin=ccur;
-          zltime = time+1;
-          if (ccur < 0)
-            return ES_FAILED;
-        } else if (t[e->i].optional() && (t[e->i].c() > ccur)) {
-          GECODE_ME_CHECK(t[e->i].excluded(home));
+    for (int i=t.size(); i--; )
+      if (t[i].optional()) {
+        // Exclude task if its required part overloads the resource
+        if (t[i].lst() < t[i].ect()) {
+          int k = tt.next(tt.find(t[i].lst()),cmax-t[i].c());
+          if (tt.start(k) < t[i].ect())
+            GECODE_ME_CHECK(t[i].excluded(home));
         }
-      
-      // Exploit that tasks are sorted according to capacity
-      for (Iter::Values::BitSet<Support::BitSet<Region> > j(tasks); 
-           j() && (t[j.val()].c() > ccur); ++j) 
-        // Task j cannot run from time to next time - 1
-        if (t[j.val()].mandatory()) {
-          if (t[j.val()].pmin() > 0) {
-            GECODE_ME_CHECK(t[j.val()].norun(home, time, e->t - 1));
-          } else {
-            GECODE_ME_CHECK(t[j.val()].norun(home, zltime, e->t - 1));
-          }
+      } else if (t[i].mandatory() && !t[i].assigned()) {
+        // Task cannot run where the profile leaves too little capacity
+        int est=t[i].est(), lct=t[i].lct();
+        int lst=t[i].lst(), ect=t[i].ect();
+        int x = cmax - t[i].c();
+        if (lst < ect) {
+          // The task is part of the profile during its required part
+          GECODE_ES_CHECK(timetable(home,tt,t[i],est,lst,x));
+          GECODE_ES_CHECK(timetable(home,tt,t[i],ect,lct,x));
+        } else {
+          GECODE_ES_CHECK(timetable(home,tt,t[i],est,lct,x));
         }
-    }
+      }
 
-    GECODE_ME_CHECK(c.gq(home,cmax-cmin));
+    GECODE_ME_CHECK(c.gq(home,creq));
 
     subsumed = assigned;
     return ES_NOFIX;
@@ -41,22 +41,32 @@ namespace Gecode { namespace Int { namespace Cumulative {
   
   template<class ManTask, class Cap>
   forceinline
-  ManProp<ManTask,Cap>::ManProp(Home home, Cap c0, TaskArray<ManTask>& t)
-    : TaskProp<ManTask,Int::PC_INT_DOM>(home,t), c(c0) {
+  ManProp<ManTask,Cap>::ManProp(Home home, Cap c0, TaskArray<ManTask>& t,
+                                bool ttef0)
+    : TaskProp<ManTask,Int::PC_INT_DOM>(home,t), c(c0), ttef(ttef0), ca(home) {
     c.subscribe(home,*this,Int::PC_INT_BND);
+    cp.init(home,t.size());
+    for (int i=t.size(); i--; ) {
+      compulsory(cp,i,t[i]);
+      if (!t[i].assigned())
+        (void) new (home) ProfileAdvisor<ManTask>(home,*this,ca,t[i],i);
+    }
   }
 
   template<class ManTask, class Cap>
   forceinline
   ManProp<ManTask,Cap>::ManProp(Space& home, bool shared, 
                                 ManProp<ManTask,Cap>& p) 
-    : TaskProp<ManTask,Int::PC_INT_DOM>(home,shared,p) {
+    : TaskProp<ManTask,Int::PC_INT_DOM>(home,shared,p), ttef(p.ttef) {
     c.update(home,shared,p.c);
+    cp.update(home,p.cp);
+    ca.update(home,shared,p.ca);
   }
 
   template<class ManTask, class Cap>
   forceinline ExecStatus 
-  ManProp<ManTask,Cap>::post(Home home, Cap c, TaskArray<ManTask>& t) {
+  ManProp<ManTask,Cap>::post(Home home, Cap c, TaskArray<ManTask>& t,
+                             bool ttef) {
     // Capacity must be nonnegative
     GECODE_ME_CHECK(c.gq(home, 0));
     // Check that tasks do not overload resource
@@ -73,7 +83,7 @@ namespace Gecode { namespace Int { namespace Cumulative {
         return Unary::ManProp<typename TaskTraits<ManTask>::UnaryTask>
           ::post(home,mt);
       } else {
-        (void) new (home) ManProp<ManTask,Cap>(home,c,t);
+        (void) new (home) ManProp<ManTask,Cap>(home,c,t,ttef);
       }
     }
     return ES_OK;
@@ -88,11 +98,21 @@ namespace Gecode { namespace Int { namespace Cumulative {
   template<class ManTask, class Cap>  
   forceinline size_t 
   ManProp<ManTask,Cap>::dispose(Space& home) {
+    ca.dispose(home);
+    cp.dispose(home);
     (void) TaskProp<ManTask,Int::PC_INT_DOM>::dispose(home);
     c.cancel(home,*this,PC_INT_BND);
     return sizeof(*this);
   }
 
+  template<class ManTask, class Cap>
+  ExecStatus
+  ManProp<ManTask,Cap>::advise(Space& home, Advisor& _a, const Delta&) {
+    ProfileAdvisor<ManTask>& a = static_cast<ProfileAdvisor<ManTask>&>(_a);
+    a.profile(cp);
+    return a.fixed() ? home.ES_FIX_DISPOSE(ca,a) : ES_FIX;
+  }
+
   template<class ManTask, class Cap>
   ExecStatus 
   ManProp<ManTask,Cap>::propagate(Space& home, const ModEventDelta& med) {
@@ -100,8 +120,10 @@ namespace Gecode { namespace Int { namespace Cumulative {
     if (Int::IntView::me(med) != Int::ME_INT_DOM)
       GECODE_ES_CHECK(overload(home,c.max(),t));
     GECODE_ES_CHECK(edgefinding(home,c.max(),t));
+    if (ttef)
+      GECODE_ES_CHECK(ttedgefinding(home,c.max(),t));
     bool subsumed;
-    ExecStatus es = basic(home,subsumed,c,t);
+    ExecStatus es = basic(home,subsumed,c,t,cp);
     GECODE_ES_CHECK(es);
     if (subsumed)
       return home.ES_SUBSUMED(*this);
@@ -43,22 +43,32 @@ namespace Gecode { namespace Int { namespace Cumulative {
   
   template<class OptTask, class Cap>
   forceinline
-  OptProp<OptTask,Cap>::OptProp(Home home, Cap c0, TaskArray<OptTask>& t)
-    : TaskProp<OptTask,Int::PC_INT_DOM>(home,t), c(c0) {
+  OptProp<OptTask,Cap>::OptProp(Home home, Cap c0, TaskArray<OptTask>& t,
+                                bool ttef0)
+    : TaskProp<OptTask,Int::PC_INT_DOM>(home,t), c(c0), ttef(ttef0), ca(home) {
     c.subscribe(home,*this,PC_INT_BND);
+    cp.init(home,t.size());
+    for (int i=t.size(); i--; ) {
+      compulsory(cp,i,t[i]);
+      if (!t[i].assigned())
+        (void) new (home) ProfileAdvisor<OptTask>(home,*this,ca,t[i],i);
+    }
   }
 
   template<class OptTask, class Cap>
   forceinline
   OptProp<OptTask,Cap>::OptProp(Space& home, bool shared,
                                 OptProp<OptTask,Cap>& p) 
-    : TaskProp<OptTask,Int::PC_INT_DOM>(home,shared,p) {
+    : TaskProp<OptTask,Int::PC_INT_DOM>(home,shared,p), ttef(p.ttef) {
     c.update(home,shared,p.c);
+    cp.update(home,p.cp);
+    ca.update(home,shared,p.ca);
   }
 
   template<class OptTask, class Cap>
   forceinline ExecStatus 
-  OptProp<OptTask,Cap>::post(Home home, Cap c, TaskArray<OptTask>& t) {
+  OptProp<OptTask,Cap>::post(Home home, Cap c, TaskArray<OptTask>& t,
+                             bool ttef) {
     // Capacity must be nonnegative
     GECODE_ME_CHECK(c.gq(home, 0));
     // Check for overload by single task and remove excluded tasks
@@ -96,9 +106,9 @@ namespace Gecode { namespace Int { namespace Cumulative {
       for (int i=m; i--; )
         mt[i].init(t[i]);
       return ManProp<typename TaskTraits<OptTask>::ManTask,Cap>
-        ::post(home,c,mt);
+        ::post(home,c,mt,ttef);
     }
-    (void) new (home) OptProp<OptTask,Cap>(home,c,t);
+    (void) new (home) OptProp<OptTask,Cap>(home,c,t,ttef);
     return ES_OK;
   }
 
@@ -111,11 +121,21 @@ namespace Gecode { namespace Int { namespace Cumulative {
   template<class OptTask, class Cap>  
   forceinline size_t 
   OptProp<OptTask,Cap>::dispose(Space& home) {
+    ca.dispose(home);
+    cp.dispose(home);
     (void) TaskProp<OptTask,Int::PC_INT_DOM>::dispose(home);
     c.cancel(home,*this,PC_INT_BND);
     return sizeof(*this);
   }
 
+  template<class OptTask, class Cap>
+  ExecStatus
+  OptProp<OptTask,Cap>::advise(Space& home, Advisor& _a, const Delta&) {
+    ProfileAdvisor<OptTask>& a = static_cast<ProfileAdvisor<OptTask>&>(_a);
+    a.profile(cp);
+    return a.fixed() ? home.ES_FIX_DISPOSE(ca,a) : ES_FIX;
+  }
+
   template<class OptTask, class Cap>
   ExecStatus 
   OptProp<OptTask,Cap>::propagate(Space& home, const ModEventDelta& med) {
@@ -127,7 +147,7 @@ namespace Gecode { namespace Int { namespace Cumulative {
       GECODE_ES_CHECK(overload(home,c.max(),t));
 
     bool subsumed;
-    GECODE_ES_CHECK(basic(home,subsumed,c,t));
+    GECODE_ES_CHECK(basic(home,subsumed,c,t,cp));
     if (subsumed)
       return home.ES_SUBSUMED(*this);
 
@@ -145,6 +165,8 @@ namespace Gecode { namespace Int { namespace Cumulative {
       // Truncate array to only contain mandatory tasks
       t.size(i);
       GECODE_ES_CHECK(edgefinding(home,c.max(),t));
+      if (ttef)
+        GECODE_ES_CHECK(ttedgefinding(home,c.max(),t));
       // Restore to also include optional tasks
       t.size(n);
     }
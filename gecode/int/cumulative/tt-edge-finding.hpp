@@ -0,0 +1,211 @@
+/* -*- mode: C++; c-basic-offset: 2; indent-tabs-mode: nil -*- */
+/*
+ *  Main authors:
+ *     Christian Schulte <schulte@gecode.org>
+ *
+ *  Copyright:
+ *     Christian Schulte, 2011
+ *
+ *  Last modified:
+ *     $Date$ by $Author$
+ *     $Revision$
+ *
+ *  This file is part of Gecode, the generic constraint
+ *  development environment:
+ *     http://www.gecode.org
+ *
+ *  Permission is hereby granted, free of charge, to any person obtaining
+ *  a copy of this software and associated documentation files (the
+ *  "Software"), to deal in the Software without restriction, including
+ *  without limitation the rights to use, copy, modify, merge, publish,
+ *  distribute, sublicense, and/or sell copies of the Software, and to
+ *  permit persons to whom the Software is furnished to do so, subject to
+ *  the following conditions:
+ *
+ *  The above copyright notice and this permission notice shall be
+ *  included in all copies or substantial portions of the Software.
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ *  EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ *  MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ *  NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE
+ *  LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+ *  OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+ *  WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ */
+
+
+#include <algorithm>
+
+namespace Gecode { namespace Int { namespace Cumulative {
+
+  /// Event for a change of the compulsory-part profile
+  class ProfileEvent {
+  public:
+    int t; ///< Time of event
+    int c; ///< Change of resource usage
+    /// Order among events
+    bool operator <(const ProfileEvent& e) const {
+      return t < e.t;
+    }
+  };
+
+  /// Sort task indices by increasing latest completion time
+  template<class TaskView>
+  class LctOrder {
+  public:
+    /// The tasks
+    const TaskViewArray<TaskView>& t;
+    /// Initialize with tasks \a t0
+    LctOrder(const TaskViewArray<TaskView>& t0) : t(t0) {}
+    /// Sort order
+    bool operator ()(int i, int j) const {
+      return t[i].lct() < t[j].lct();
+    }
+  };
+
+  /**
+   * \brief Compute the energy of the compulsory-part profile
+   *
+   * Stores in \a en[k] the energy of the compulsory parts of the tasks
+   * \a t before time \a q[k] for the \a n increasing times \a q.
+   */
+  template<class TaskView>
+  forceinline void
+  profile(Region& r, const TaskViewArray<TaskView>& t,
+          const int* q, double* en, int n) {
+    ProfileEvent* e = r.alloc<ProfileEvent>(2*t.size()+1);
+    int m = 0;
+    for (int i=t.size(); i--; )
+      if ((t[i].lst() < t[i].ect()) && (t[i].c() > 0)) {
+        e[m].t = t[i].lst(); e[m].c =  t[i].c(); m++;
+        e[m].t = t[i].ect(); e[m].c = -t[i].c(); m++;
+      }
+    Support::quicksort(e, m);
+    e[m].t = Int::Limits::infinity; e[m].c = 0;
+    double energy = 0.0;
+    int height = 0;
+    int last = Int::Limits::min;
+    ProfileEvent* f = e;
+    for (int k=0; k<n; k++) {
+      for ( ; f->t <= q[k]; f++) {
+        energy += height*(static_cast<double>(f->t) - last);
+        height += f->c; last = f->t;
+      }
+      en[k] = energy + height*(static_cast<double>(q[k]) - last);
+    }
+    r.free<ProfileEvent>(e, 2*t.size()+1);
+  }
+
+  template<class TaskView>
+  forceinline ExecStatus
+  ttedgefinding(Space& home, int c, TaskViewArray<TaskView>& t) {
+    sort<TaskView,STO_EST,true>(t);
+
+    Region r(home);
+    int n = t.size();
+
+    // Task indices sorted by latest completion time
+    int* lct = r.alloc<int>(n);
+    for (int i=n; i--; )
+      lct[i] = i;
+    LctOrder<TaskView> lo(t);
+    Support::quicksort(lct, n, lo);
+
+    // Profile energy before earliest start and latest completion times
+    double* en_est = r.alloc<double>(n);
+    double* en_lct = r.alloc<double>(n);
+    {
+      int* q = r.alloc<int>(n);
+      for (int i=n; i--; )
+        q[i] = t[i].est();
+      profile(r, t, q, en_est, n);
+      for (int i=n; i--; )
+        q[i] = t[lct[i]].lct();
+      profile(r, t, q, en_lct, n);
+      r.free<int>(q, n);
+    }
+
+    // Energy of the parts of the tasks that are not compulsory
+    double* free = r.alloc<double>(n);
+    for (int i=n; i--; )
+      free[i] = static_cast<double>(t[i].c()) *
+        (t[i].pmin() -
+         std::max(0.0, static_cast<double>(t[i].ect()) - t[i].lst()));
+
+    // Updated earliest start times
+    int* est = r.alloc<int>(n);
+    for (int i=n; i--; )
+      est[i] = t[i].est();
+
+    // Consider all task intervals [begin,end) from est and lct
+    for (int k=n; k--; ) {
+      int end = t[lct[k]].lct();
+      if ((k > 0) && (t[lct[k-1]].lct() == end))
+        continue;
+      // Free energy of tasks in the interval
+      double en_in = 0.0;
+      // Task that requires most free energy when starting at its est
+      int u = -1;
+      double en_u = 0.0;
+      for (int i=n; i--; ) {
+        if (t[i].est() >= end)
+          continue;
+        if (t[i].lct() <= end) {
+          en_in += free[i];
+        } else {
+          double e = std::min(end, t[i].ect());
+          double en_i = static_cast<double>(t[i].c()) *
+            (e - t[i].est() - std::max(0.0, e - t[i].lst()));
+          if (en_i > en_u) {
+            en_u = en_i; u = i;
+          }
+        }
+        int begin = t[i].est();
+        // Energy still available in the interval
+        double avail =
+          static_cast<double>(c)*(static_cast<double>(end) - begin) - en_in -
+          (en_lct[k] - en_est[i]);
+        if (avail < 0.0)
+          return ES_FAILED;
+        if (en_u > avail) {
+          /*
+           * Task u cannot start at its est: when starting at s it
+           * occupies at least [s,max(s+pmin,ect)), hence it must
+           * overlap with the interval by at most f time units
+           * beyond its compulsory part.
+           */
+          double cp = std::max(0.0, static_cast<double>
+                               (std::min(end, t[u].ect())) - t[u].lst());
+          double f = floor(avail / t[u].c()) + cp;
+          double s = (t[u].pmin() <= f) ?
+            std::min(end, t[u].ect()) - f : end - f;
+          if (s > Int::Limits::max)
+            return ES_FAILED;
+          if (s > est[u])
+            est[u] = static_cast<int>(s);
+        }
+      }
+    }
+
+    for (int i=n; i--; )
+      if (est[i] > t[i].est())
+        GECODE_ME_CHECK(t[i].est(home,est[i]));
+
+    return ES_OK;
+  }
+
+  template<class Task>
+  ExecStatus
+  ttedgefinding(Space& home, int c, TaskArray<Task>& t) {
+    TaskViewArray<typename TaskTraits<Task>::TaskViewFwd> f(t);
+    GECODE_ES_CHECK(ttedgefinding(home,c,f));
+    TaskViewArray<typename TaskTraits<Task>::TaskViewBwd> b(t);
+    GECODE_ES_CHECK(ttedgefinding(home,c,b));
+    return ES_OK;
+  }
+    
+}}}
+
+// STATISTICS: int-prop
@@ -39,6 +39,7 @@
 #define __GECODE_INT_CUMULATIVES_HH__
 
 #include <gecode/int.hh>
+#include <gecode/int/task.hh>
 
 namespace Gecode { namespace Int { namespace Cumulatives {
 
@@ -77,12 +78,35 @@ namespace Gecode { namespace Int { namespace Cumulatives {
    */
 
 
+  /**
+   * \brief %Advisor for a task of the cumulatives constraint
+   *
+   * The advisor is subscribed to the machine, start, end, and height
+   * views of the task and updates the task's intervals in the profiles
+   * of the propagator.
+   */
+  class TaskAdvisor : public Advisor {
+  public:
+    /// Index of the task
+    int i;
+    /// Create advisor for task \a i0
+    TaskAdvisor(Space& home, Propagator& p, Council<TaskAdvisor>& c, int i0);
+    /// Clone advisor \a a
+    TaskAdvisor(Space& home, bool share, TaskAdvisor& a);
+  };
+
   /**
    * \brief %Propagator for the cumulatives constraint
    *
    * This class implements Beldiceanu's and Carlsson's sweep-line
    * propagation algorithm for the cumulatives constraint.
    *
+   * The events for the resource profile of each machine (the check
+   * and profile events of the original algorithm) are not recomputed
+   * and sorted from scratch but are maintained incrementally by
+   * advisors, see Int::Profile. Only the pruning events are created
+   * and sorted for each sweep.
+   *
    * Requires \code #include <gecode/int/cumulatives.hh> \endcode
    * \ingroup FuncIntProp
    */
@@ -96,12 +120,24 @@ namespace Gecode { namespace Int { namespace Cumulatives {
     ViewArray<ViewU>  u;
     SharedArray<int>  c;
     const bool        at_most;
+    /// Profiles of check and profile events (one per machine)
+    Profile*          pr;
+    /// The advisors for the tasks
+    Council<TaskAdvisor> ca;
 
     Val(Space& home, bool share, Val<ViewM, ViewP, ViewU, View>& p);
     Val(Home home, const ViewArray<ViewM>&, const ViewArray<View>&,
         const ViewArray<ViewP>&, const ViewArray<View>&,
         const ViewArray<ViewU>&, const SharedArray<int>&, bool);
 
+    /// Update the intervals of task \a t in the profiles
+    void profile(int t);
+    /// Test whether task \a t is assigned
+    bool assigned(int t) const;
+    /// Subscribe advisor \a a to the views of task \a t
+    void subscribe(Space& home, int t, Advisor& a);
+    /// Cancel subscriptions of advisor \a a to the views of task \a t
+    void cancel(Space& home, int t, Advisor& a);
     ExecStatus prune(Space& home, int low, int up, int r,
                      int ntask, int su,
                      int* contribution,
@@ -113,6 +149,8 @@ namespace Gecode { namespace Int { namespace Cumulatives {
     virtual PropCost cost(const Space& home, const ModEventDelta& med) const;
     /// Perform propagation
     virtual ExecStatus propagate(Space& home, const ModEventDelta& med);
+    /// Give advice to propagator
+    virtual ExecStatus advise(Space& home, Advisor& a, const Delta& d);
     /// Post propagator
     static ExecStatus post(Home home, const ViewArray<ViewM>&,
                            const ViewArray<View>&, const ViewArray<ViewP>&,
@@ -46,6 +46,82 @@
 
 namespace Gecode { namespace Int { namespace Cumulatives {
 
+  /*
+   * Advisor
+   *
+   */
+  forceinline
+  TaskAdvisor::TaskAdvisor(Space& home, Propagator& p,
+                           Council<TaskAdvisor>& c, int i0)
+    : Advisor(home,p,c), i(i0) {}
+
+  forceinline
+  TaskAdvisor::TaskAdvisor(Space& home, bool share, TaskAdvisor& a)
+    : Advisor(home,share,a), i(a.i) {}
+
+
+  /*
+   * Maintaining the profiles
+   *
+   * The profile of machine r has three items for each task t: item
+   * 3*t is the check interval, item 3*t+1 the profile interval for
+   * the compulsory part, and item 3*t+2 the profile interval for the
+   * task possibly running on the machine.
+   *
+   */
+  template<class ViewM, class ViewP, class ViewU, class View>
+  forceinline bool
+  Val<ViewM,ViewP,ViewU,View>::assigned(int t) const {
+    return m[t].assigned() && s[t].assigned() &&
+      e[t].assigned() && u[t].assigned();
+  }
+
+  template<class ViewM, class ViewP, class ViewU, class View>
+  forceinline void
+  Val<ViewM,ViewP,ViewU,View>::subscribe(Space& home, int t, Advisor& a) {
+    m[t].subscribe(home,a); s[t].subscribe(home,a);
+    e[t].subscribe(home,a); u[t].subscribe(home,a);
+  }
+
+  template<class ViewM, class ViewP, class ViewU, class View>
+  forceinline void
+  Val<ViewM,ViewP,ViewU,View>::cancel(Space& home, int t, Advisor& a) {
+    m[t].cancel(home,a); s[t].cancel(home,a);
+    e[t].cancel(home,a); u[t].cancel(home,a);
+  }
+
+  template<class ViewM, class ViewP, class ViewU, class View>
+  void
+  Val<ViewM,ViewP,ViewU,View>::profile(int t) {
+    int h = at_most ? u[t].min() : u[t].max();
+    for (int r = c.size(); r--; ) {
+      if (m[t].assigned() && (m[t].val() == r) &&
+          (s[t].max() < e[t].min())) {
+        if (at_most
+            ? u[t].min() > std::min(0, c[r])
+            : u[t].max() < std::max(0, c[r]))
+          pr[r].set(3*t, s[t].max(), e[t].min(), 1);
+        else
+          pr[r].empty(3*t);
+        if (at_most ? u[t].min() > 0 : u[t].max() < 0)
+          pr[r].set(3*t+1, s[t].max(), e[t].min(), h);
+        else
+          pr[r].empty(3*t+1);
+      } else {
+        pr[r].empty(3*t); pr[r].empty(3*t+1);
+      }
+      if (m[t].in(r) && (at_most ? u[t].min() < 0 : u[t].max() > 0))
+        pr[r].set(3*t+2, s[t].min(), e[t].max(), h);
+      else
+        pr[r].empty(3*t+2);
+    }
+  }
+
+
+  /*
+   * Propagator
+   *
+   */
   template<class ViewM, class ViewP, class ViewU, class View>
   forceinline
   Val<ViewM,ViewP,ViewU,View>::Val(Home home,
@@ -57,7 +133,7 @@ namespace Gecode { namespace Int { namespace Cumulatives {
                                    const SharedArray<int>& _c,
                                    bool _at_most) :
     Propagator(home),
-    m(_m), s(_s), p(_p), e(_e), u(_u), c(_c), at_most(_at_most) {
+    m(_m), s(_s), p(_p), e(_e), u(_u), c(_c), at_most(_at_most), ca(home) {
     home.notice(*this,AP_DISPOSE);
 
     m.subscribe(home,*this,Int::PC_INT_DOM);
@@ -65,6 +141,15 @@ namespace Gecode { namespace Int { namespace Cumulatives {
     p.subscribe(home,*this,Int::PC_INT_BND);
     e.subscribe(home,*this,Int::PC_INT_BND);
     u.subscribe(home,*this,Int::PC_INT_BND);
+
+    pr = static_cast<Space&>(home).alloc<Profile>(c.size());
+    for (int r = c.size(); r--; )
+      pr[r].init(home,3*s.size());
+    for (int t = s.size(); t--; ) {
+      profile(t);
+      if (!assigned(t))
+        subscribe(home,t,*new (home) TaskAdvisor(home,*this,ca,t));
+    }
   }
 
   template<class ViewM, class ViewP, class ViewU, class View>
@@ -89,6 +174,10 @@ namespace Gecode { namespace Int { namespace Cumulatives {
     e.update(home, share, vp.e);
     u.update(home, share, vp.u);
     c.update(home, share, vp.c);
+    pr = home.alloc<Profile>(c.size());
+    for (int r = c.size(); r--; )
+      pr[r].update(home,vp.pr[r]);
+    ca.update(home,share,vp.ca);
   }
 
   template<class ViewM, class ViewP, class ViewU, class View>
@@ -101,7 +190,13 @@ namespace Gecode { namespace Int { namespace Cumulatives {
       p.cancel(home,*this,Int::PC_INT_BND);
       e.cancel(home,*this,Int::PC_INT_BND);
       u.cancel(home,*this,Int::PC_INT_BND);
+      for (Advisors<TaskAdvisor> as(ca); as(); ++as)
+        cancel(home,as.advisor().i,as.advisor());
     }
+    ca.dispose(home);
+    for (int r = c.size(); r--; )
+      pr[r].dispose(home);
+    home.free<Profile>(pr,c.size());
     c.~SharedArray();
     (void) Propagator::dispose(home);
     return sizeof(*this);
@@ -119,41 +214,28 @@ namespace Gecode { namespace Int { namespace Cumulatives {
     return new (home) Val<ViewM,ViewP,ViewU,View>(home,share,*this);
   }
 
-  /// Types of events for the sweep-line
-  typedef enum {EVENT_CHCK, EVENT_PROF, EVENT_PRUN} ev_t;
-  /// An event collects the information for one evnet for the sweep-line
+  template<class ViewM, class ViewP, class ViewU, class View>
+  ExecStatus
+  Val<ViewM,ViewP,ViewU,View>::advise(Space& home, Advisor& _a, const Delta&) {
+    TaskAdvisor& a = static_cast<TaskAdvisor&>(_a);
+    profile(a.i);
+    if (assigned(a.i)) {
+      cancel(home,a.i,a);
+      return home.ES_FIX_DISPOSE(ca,a);
+    }
+    return ES_FIX;
+  }
+
+  /// A pruning event for the sweep-line
   class Event
   {
   public:
-    /// The type of the event
-    ev_t e;
     /// The task this event refers to
     int task;
     /// The date of this event
     int date;
-    /// The quantity changed by this event (if any)
-    int inc;
-    /** If the type is EVENT_PROF and it is the first of the pair,
-     * this value is true. Added to handle contribution-values
-     * correctly for both at_most and at_least.
-     */
-    bool first_prof;
-
-    /// Simple constructor
-    Event(ev_t _e, int _task, int _date, int _inc = 0, bool _first_prof = false)
-      : e(_e), task(_task), date(_date), inc(_inc), first_prof(_first_prof)
-    {}
-
-    // Default constructor for region-allocated memory
-    Event(void) {}
-
     /// Order events based on date.
     bool operator <(const Event& ev) const {
-      if (date == ev.date) {
-        if (e == EVENT_PROF && ev.e != EVENT_PROF) return true;
-        if (e == EVENT_CHCK && ev.e == EVENT_PRUN) return true;
-        return false;
-      }
       return date < ev.date;
     }
   };
@@ -251,16 +333,6 @@ namespace Gecode { namespace Int { namespace Cumulatives {
     return ES_OK;
   }
 
-  namespace {
-    template<class C>
-    class Less {
-    public:
-      bool operator ()(const C& lhs, const C& rhs) {
-        return lhs < rhs;
-      }
-    };
-  }
-
   template<class ViewM, class ViewP, class ViewU, class View>
   ExecStatus
   Val<ViewM,ViewP,ViewU,View>::propagate(Space& home, const ModEventDelta&) {
@@ -275,97 +347,75 @@ namespace Gecode { namespace Int { namespace Cumulatives {
       }
     // Propagate information for machine r
     Region region(home);
-    Event *events = region.alloc<Event>(s.size()*8);
+    Event *events = region.alloc<Event>(s.size());
     int  events_size;
     int *prune_tasks = region.alloc<int>(s.size());
     int  prune_tasks_size;
     int *contribution = region.alloc<int>(s.size());
     for (int r = c.size(); r--; ) {
-      events_size = 0;
-#define GECODE_PUSH_EVENTS(E) assert(events_size < s.size()*8);     \
-        events[events_size++] = E
-
-      // Find events for sweep-line
-      for (int t = s.size(); t--; ) {
-        if (m[t].assigned() &&
-            m[t].val() == r &&
-            s[t].max() < e[t].min()) {
-          if (at_most
-              ? u[t].min() > std::min(0, c[r])
-              : u[t].max() < std::max(0, c[r])) {
-            GECODE_PUSH_EVENTS(Event(EVENT_CHCK, t, s[t].max(), 1));
-            GECODE_PUSH_EVENTS(Event(EVENT_CHCK, t, e[t].min(), -1));
-          }
-          if (at_most
-              ? u[t].min() > 0
-              : u[t].max() < 0) {
-            GECODE_PUSH_EVENTS(Event(EVENT_PROF, t, s[t].max(),
-                                     at_most ? u[t].min() : u[t].max(), true));
-            GECODE_PUSH_EVENTS(Event(EVENT_PROF, t, e[t].min(),
-                                     at_most ? -u[t].min() : -u[t].max()));
-          }
-        }
+      // Update check and profile events
+      Profile& pf = pr[r];
+      pf.sync(home);
 
-        if (m[t].in(r)) {
-          if (at_most
-              ? u[t].min() < 0
-              : u[t].max() > 0) {
-            GECODE_PUSH_EVENTS(Event(EVENT_PROF, t, s[t].min(),
-                                     at_most ? u[t].min() : u[t].max(), true));
-            GECODE_PUSH_EVENTS(Event(EVENT_PROF, t, e[t].max(),
-                                     at_most ? -u[t].min() : -u[t].max()));
-          }
-          if (!(m[t].assigned() &&
-                u[t].assigned() &&
-                s[t].assigned() &&
-                e[t].assigned())) {
-            GECODE_PUSH_EVENTS(Event(EVENT_PRUN, t, s[t].min()));
-          }
+      // Find pruning events for sweep-line
+      events_size = 0;
+      for (int t = s.size(); t--; )
+        if (m[t].in(r) && !assigned(t)) {
+          events[events_size].task = t;
+          events[events_size].date = s[t].min();
+          events_size++;
         }
-      }
-#undef GECODE_PUSH_EVENTS
 
       // If there are no events, continue with next machine
-      if (events_size == 0) {
+      if ((events_size == 0) && (pf.events() == 0)) {
         continue;
       }
 
-      // Sort the events according to date
-      Less<Event> less;
-      Support::insertion(&events[0], events_size, less);
+      // Sort the pruning events according to date
+      Support::quicksort<Event>(events, events_size);
 
       // Sweep line along d, starting at 0
       int d        = 0;
       int ntask    = 0;
       int su  = 0;
       int ei = 0;
+      int pi = 0;
 
       prune_tasks_size = 0;
       for (int i = s.size(); i--; ) contribution[i] = 0;
 
-      d = events[ei].date;
-      while (ei < events_size) {
-        if (events[ei].e != EVENT_PRUN) {
-          if (d != events[ei].date) {
-            GECODE_ES_CHECK(prune(home, d, events[ei].date-1, r,
+      // Check and profile events precede pruning events with the same date
+      if (pf.events() == 0)
+        d = events[0].date;
+      else if (events_size == 0)
+        d = pf.time(0);
+      else
+        d = std::min(pf.time(0),events[0].date);
+      while ((pi < pf.events()) || (ei < events_size)) {
+        if ((pi < pf.events()) &&
+            ((ei == events_size) || (pf.time(pi) <= events[ei].date))) {
+          if (d != pf.time(pi)) {
+            GECODE_ES_CHECK(prune(home, d, pf.time(pi)-1, r,
                                   ntask, su,
                                   contribution, prune_tasks, prune_tasks_size));
-            d = events[ei].date;
+            d = pf.time(pi);
           }
-          if (events[ei].e == EVENT_CHCK) {
-            ntask += events[ei].inc;
-          } else /* if (events[ei].e == EVENT_PROF) */ {
-            su += events[ei].inc;
-            if(events[ei].first_prof)
-              contribution[events[ei].task] = at_most
-                ? std::max(contribution[events[ei].task], events[ei].inc)
-                : std::min(contribution[events[ei].task], events[ei].inc);
+          int i = pf.item(pi);
+          if (i % 3 == 0) {
+            ntask += pf.height(pi);
+          } else {
+            su += pf.height(pi);
+            if (pf.begin(pi))
+              contribution[i / 3] = at_most
+                ? std::max(contribution[i / 3], pf.height(pi))
+                : std::min(contribution[i / 3], pf.height(pi));
           }
-        } else /* if (events[ei].e == EVENT_PRUN) */ {
+          pi++;
+        } else {
           assert(prune_tasks_size<s.size());
           prune_tasks[prune_tasks_size++] = events[ei].task;
+          ei++;
         }
-        ei++;
       }
 
       GECODE_ES_CHECK(prune(home, d, d, r,
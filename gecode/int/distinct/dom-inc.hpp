@@ -0,0 +1,506 @@
+/* -*- mode: C++; c-basic-offset: 2; indent-tabs-mode: nil -*- */
+/*
+ *  Main authors:
+ *     Christian Schulte <schulte@gecode.org>
+ *
+ *  Copyright:
+ *     Christian Schulte, 2011
+ *
+ *  Last modified:
+ *     $Date$ by $Author$
+ *     $Revision$
+ *
+ *  This file is part of Gecode, the generic constraint
+ *  development environment:
+ *     http://www.gecode.org
+ *
+ *  Permission is hereby granted, free of charge, to any person obtaining
+ *  a copy of this software and associated documentation files (the
+ *  "Software"), to deal in the Software without restriction, including
+ *  without limitation the rights to use, copy, modify, merge, publish,
+ *  distribute, sublicense, and/or sell copies of the Software, and to
+ *  permit persons to whom the Software is furnished to do so, subject to
+ *  the following conditions:
+ *
+ *  The above copyright notice and this permission notice shall be
+ *  included in all copies or substantial portions of the Software.
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ *  EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ *  MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ *  NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE
+ *  LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+ *  OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+ *  WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ */
+
+
+#include <climits>
+
+#include <cstdio>
+namespace Gecode { namespace Int { namespace Distinct {
+
+  /*
+   * The incremental propagation controller
+   *
+   */
+
+  template<class View>
+  forceinline
+  DomIncCtrl<View>::DomIncCtrl(void) {}
+
+  template<class View>
+  ExecStatus
+  DomIncCtrl<View>::init(Space& home, int n, View* x) {
+    // Views can be recorded twice: when modified and when assigned
+    mod = home.alloc<int>(2*n); n_mod = 0; n_val = 0;
+    el = home.alloc<unsigned int>(n); n_el = 0;
+    is_mod.init(home,static_cast<unsigned int>(n));
+    aff = home.alloc<int>(n);
+
+    Region r(home);
+    {
+      // Eliminate values of assigned views such that they need no nodes
+      int* a = r.alloc<int>(n);
+      int n_a = 0;
+      for (int i=n; i--; )
+        if (x[i].assigned())
+          a[n_a++] = i;
+      while (n_a > 0) {
+        int i = a[--n_a];
+        for (int j=n; j--; )
+          if (j != i) {
+            ModEvent me = x[j].nq(home,x[i].val());
+            if (me_failed(me))
+              return ES_FAILED;
+            if (me == ME_INT_VAL)
+              a[n_a++] = j;
+          }
+      }
+    }
+
+    // Positions of views that are not assigned
+    int* p = r.alloc<int>(n);
+    View* y = r.alloc<View>(n);
+    n_view = 0;
+    for (int i=0; i<n; i++)
+      if (!x[i].assigned()) {
+        p[n_view] = i; y[n_view] = x[i]; n_view++;
+      }
+    // Map view nodes to positions
+    ViewNode<View>** view = home.alloc<ViewNode<View>*>(n);
+    for (int i=n; i--; )
+      view[i] = NULL;
+    // All views are affected
+    n_aff = n_view; aff_free = true;
+    if (n_view > 0) {
+      GECODE_ES_CHECK(vvg.init(home,n_view,y));
+      for (int i=n_view; i--; ) {
+        view[p[i]] = vvg.view[i]; aff[i] = p[i];
+      }
+    }
+    vvg.view = view; vvg.n_view = n;
+    return ES_OK;
+  }
+
+  template<class View>
+  forceinline void
+  DomIncCtrl<View>::modified(int i, bool assigned) {
+    if (!vvg.initialized())
+      return;
+    if (!is_mod.get(static_cast<unsigned int>(i))) {
+      is_mod.set(static_cast<unsigned int>(i)); mod[n_mod++] = i;
+    } else if (assigned) {
+      // Record again as the view might have been used already
+      // for value propagation before being assigned
+      mod[n_mod++] = i;
+    }
+  }
+
+  template<class View>
+  forceinline void
+  DomIncCtrl<View>::reset(void) {
+    for (int i=n_mod; i--; )
+      is_mod.clear(static_cast<unsigned int>(mod[i]));
+    n_mod = 0; n_val = 0;
+  }
+
+  template<class View>
+  ExecStatus
+  DomIncCtrl<View>::propagate_val(Space& home) {
+    // Views that get modified are added to the modified views
+    while (n_val < n_mod) {
+      int i = mod[n_val++];
+      ViewNode<View>* x = vvg.view[i];
+      if ((x == NULL) || !x->view().assigned())
+        continue;
+      int v = x->view().val();
+      // Find value node for v (edges might not be synchronized yet)
+      Edge<View>* e = x->val_edges();
+      while (e->val(x)->val() != v)
+        e = e->next_edge();
+      ValNode<View>* n = e->val(x);
+      // Eliminate the value from all views with an edge to the value node
+      for (Edge<View>* f = n->edge_fst(); f != n->edge_lst(); f=f->next())
+        if (f->view(n) != x)
+          GECODE_ME_CHECK(f->view(n)->view().nq(home,v));
+      if ((n->matching() != NULL) && (n->matching()->view(n) != x))
+        GECODE_ME_CHECK(n->matching()->view(n)->view().nq(home,v));
+      // Eliminate view node but remember its block
+      x->edge_fst()->val(x)->matching(NULL);
+      for (Edge<View>* e = x->val_edges(); e != NULL; e = e->next_edge())
+        e->unlink();
+      vvg.view[i] = NULL; n_view--;
+      el[n_el++] = x->comp;
+    }
+    return ES_OK;
+  }
+
+  template<class View>
+  forceinline bool
+  DomIncCtrl<View>::empty(void) const {
+    return n_view == 0;
+  }
+
+  template<class View>
+  forceinline bool
+  DomIncCtrl<View>::purge(void) {
+    if (vvg.count > (UINT_MAX >> 1)) {
+      vvg.count = 1;
+      for (int i=vvg.n_view; i--; )
+        if (vvg.view[i] != NULL)
+          vvg.view[i]->min = 0;
+      for (ValNode<View>* v = vvg.val; v != NULL; v = v->next_val())
+        v->min = 0;
+      return true;
+    }
+    return false;
+  }
+
+  template<class View>
+  ExecStatus
+  DomIncCtrl<View>::sync(Space& home) {
+    Region r(home);
+    // Components of modified and eliminated views
+    unsigned int* cm = r.alloc<unsigned int>(n_mod+n_el+1);
+    int n_cm = 0;
+    if (n_el > 0) {
+      // Eliminating a view might have left a free value
+      for (int i=n_el; i--; )
+        cm[n_cm++] = el[i];
+      cm[n_cm++] = comp_free;
+      n_el = 0;
+    }
+    // Stack for view nodes to be rematched
+    ViewNodeStack re(r,n_mod);
+    for (int i = n_mod; i--; ) {
+      ViewNode<View>* x = vvg.view[mod[i]];
+      if (x == NULL)
+        continue;
+      cm[n_cm++] = x->comp;
+      ViewRanges<View> r(x->view());
+      Edge<View>*  m = x->edge_fst();      // Matching edge
+      Edge<View>** p = x->val_edges_ref();
+      Edge<View>*  e = *p;
+      do {
+        while (e->val(x)->val() < r.min()) {
+          // Skip edge
+          e->unlink(); e->mark();
+          e = e->next_edge();
+        }
+        *p = e;
+        assert(r.min() == e->val(x)->val());
+        // This edges must be kept
+        for (unsigned int j=r.width(); j--; ) {
+          p = e->next_edge_ref();
+          e = e->next_edge();
+        }
+        ++r;
+      } while (r());
+      *p = NULL;
+      while (e != NULL) {
+        e->unlink(); e->mark();
+        e = e->next_edge();
+      }
+      if (m->marked()) {
+        // Matching has been deleted!
+        m->val(x)->matching(NULL);
+        re.push(x);
+      }
+    }
+    reset();
+    {
+      ViewNodeStack m(r,n_view);
+      while (!re.empty())
+        if (!vvg.match(m,re.pop()))
+          return ES_FAILED;
+    }
+    // Find views in affected blocks
+    n_aff = 0; aff_free = false;
+    if (purge()) {
+      // All blocks must be analyzed again
+      for (int i=vvg.n_view; i--; )
+        if (vvg.view[i] != NULL)
+          aff[n_aff++] = i;
+      aff_free = true;
+    } else if (n_cm > 0) {
+      Support::quicksort(cm,n_cm);
+      aff_free = (cm[0] == comp_free);
+      for (int i=vvg.n_view; i--; )
+        if (vvg.view[i] != NULL) {
+          unsigned int c = vvg.view[i]->comp;
+          int l = 0, h = n_cm-1;
+          while (l < h) {
+            int k = l + ((h-l) >> 1);
+            if (cm[k] < c) l = k+1; else h = k;
+          }
+          if (cm[l] == c)
+            aff[n_aff++] = i;
+        }
+    }
+    return ES_OK;
+  }
+
+  template<class View>
+  forceinline void
+  DomIncCtrl<View>::mark(Space& home) {
+    Region r(home);
+    vvg.count++;
+    const unsigned int count = vvg.count;
+
+    if (aff_free) {
+      // Find all nodes on simple paths in the graph that start from a
+      // free (unmatched node) by depth-first-search. The reached nodes
+      // are put into the same component: then all edges between them
+      // are used without being marked (no edge is ever marked).
+      Support::StaticStack<ValNode<View>*,Region> visit(r,vvg.n_val);
+
+      {
+        ValNode<View>** v = &vvg.val;
+        while (*v != NULL)
+          if (!(*v)->matching()) {
+            if ((*v)->empty()) {
+              *v = (*v)->next_val();
+              vvg.n_val--;
+            } else {
+              (*v)->min = count; (*v)->low = UINT_MAX;
+              (*v)->comp = comp_free;
+              visit.push(*v);
+              v = (*v)->next_val_ref();
+            }
+          } else {
+            v = (*v)->next_val_ref();
+          }
+      }
+
+      // Invariant: only value nodes are on the stack!
+      while (!visit.empty()) {
+        ValNode<View>* n = visit.pop();
+        for (Edge<View>* e = n->edge_fst(); e != n->edge_lst(); e=e->next()) {
+          ViewNode<View>* x = e->view(n);
+          if (x->min < count) {
+            x->min = count; x->low = UINT_MAX; x->comp = comp_free;
+            assert(x->edge_fst()->next() == x->edge_lst());
+            ValNode<View>* m = x->edge_fst()->val(x);
+            if (m->min < count) {
+              m->min = count; m->low = UINT_MAX; m->comp = comp_free;
+              visit.push(m);
+            }
+          }
+        }
+      }
+    }
+
+    {
+      // Compute strongly connected components of the affected blocks,
+      // nodes reached from free values count as already visited
+      Support::StaticStack<Node<View>*,Region> scc(r,vvg.n_val+n_view);
+      Support::StaticStack<Node<View>*,Region> visit(r,vvg.n_val+n_view);
+
+      unsigned int cnt0 = count+1;
+      unsigned int cnt1 = count+1;
+
+      for (int i = n_aff; i--; )
+        if (vvg.view[aff[i]]->min < count) {
+          Node<View>* w = vvg.view[aff[i]];
+        start:
+          w->low = w->min = cnt0++;
+          scc.push(w);
+          Edge<View>* e = w->edge_fst();
+          while (e != w->edge_lst()) {
+            if (e->dst(w)->min < count) {
+              visit.push(w); w->iter = e;
+              w=e->dst(w);
+              goto start;
+            }
+          next:
+            if (e->dst(w)->low < w->min)
+              w->min = e->dst(w)->low;
+            e = e->next();
+          }
+          if (w->min < w->low) {
+            w->low = w->min;
+          } else {
+            Node<View>* v;
+            do {
+              v = scc.pop();
+              v->comp = cnt1;
+              v->low  = UINT_MAX;
+            } while (v != w);
+            cnt1++;
+          }
+          if (!visit.empty()) {
+            w=visit.pop(); e=w->iter; goto next;
+          }
+        }
+      vvg.count = cnt0+1;
+    }
+  }
+
+  template<class View>
+  forceinline ExecStatus
+  DomIncCtrl<View>::tell(Space& home) {
+    for (int i = n_aff; i--; ) {
+      ViewNode<View>* x = vvg.view[aff[i]];
+      if (!x->edge_fst()->used(x)) {
+        GECODE_ME_CHECK(x->view().eq(home,x->edge_fst()->val(x)->val()));
+        x->edge_fst()->val(x)->matching(NULL);
+        for (Edge<View>* e = x->val_edges(); e != NULL; e = e->next_edge())
+          e->unlink();
+        vvg.view[aff[i]] = NULL; n_view--;
+      } else {
+        PruneVal<View> pv(x);
+        GECODE_ME_CHECK(x->view().minus_v(home,pv,false));
+        // Remove the edges for the pruned values
+        Edge<View>** p = x->val_edges_ref();
+        for (Edge<View>* e = *p; e != NULL; e = e->next_edge())
+          if (e->used(x)) {
+            *p = e; p = e->next_edge_ref();
+          } else {
+            e->unlink();
+          }
+        *p = NULL;
+      }
+    }
+    // The graph already reflects all modifications performed by tell
+    reset();
+    return ES_OK;
+  }
+
+  template<class View>
+  forceinline ExecStatus
+  DomIncCtrl<View>::propagate(Space& home) {
+    if (n_aff > 0) {
+      mark(home);
+      GECODE_ES_CHECK(tell(home));
+    }
+    return ES_OK;
+  }
+
+
+  /*
+   * The propagator proper
+   *
+   */
+
+  template<class View>
+  forceinline
+  DomInc<View>::Index::Index(Space& home, Propagator& p,
+                             Council<Index>& c, int i0)
+    : Advisor(home,p,c), i(i0) {}
+
+  template<class View>
+  forceinline
+  DomInc<View>::Index::Index(Space& home, bool share, Index& a)
+    : Advisor(home,share,a), i(a.i) {}
+
+  template<class View>
+  forceinline
+  DomInc<View>::DomInc(Home home, ViewArray<View>& x0)
+    : Propagator(home), x(x0), c(home) {
+    for (int i=x.size(); i--; )
+      if (!x[i].assigned())
+        x[i].subscribe(home,*new (home) Index(home,*this,c,i));
+    View::schedule(home,*this,ME_INT_DOM);
+  }
+
+  template<class View>
+  forceinline ExecStatus
+  DomInc<View>::post(Home home, ViewArray<View>& x) {
+    (void) new (home) DomInc<View>(home,x);
+    return ES_OK;
+  }
+
+  template<class View>
+  forceinline
+  DomInc<View>::DomInc(Space& home, bool share, DomInc<View>& p)
+    : Propagator(home,share,p) {
+    c.update(home,share,p.c);
+    // Only views that are not yet assigned still have an advisor
+    int n = 0;
+    for (Advisors<Index> as(c); as(); ++as)
+      n++;
+    x = ViewArray<View>(home,n);
+    n = 0;
+    for (Advisors<Index> as(c); as(); ++as) {
+      x[n].update(home,share,p.x[as.advisor().i]);
+      as.advisor().i = n++;
+    }
+  }
+
+  template<class View>
+  Actor*
+  DomInc<View>::copy(Space& home, bool share) {
+    return new (home) DomInc<View>(home,share,*this);
+  }
+
+  template<class View>
+  PropCost
+  DomInc<View>::cost(const Space&, const ModEventDelta& med) const {
+    if (View::me(med) == ME_INT_VAL)
+      return PropCost::linear(PropCost::LO, x.size());
+    else
+      return PropCost::linear(PropCost::HI, x.size());
+  }
+
+  template<class View>
+  forceinline size_t
+  DomInc<View>::dispose(Space& home) {
+    c.dispose(home);
+    (void) Propagator::dispose(home);
+    return sizeof(*this);
+  }
+
+  template<class View>
+  ExecStatus
+  DomInc<View>::advise(Space& home, Advisor& _a, const Delta& d) {
+    Index& a = static_cast<Index&>(_a);
+    if (View::modevent(d) == ME_INT_VAL) {
+      dc.modified(a.i,true);
+      return home.ES_NOFIX_DISPOSE(c,a);
+    }
+    dc.modified(a.i,false);
+    return ES_NOFIX;
+  }
+
+  template<class View>
+  ExecStatus
+  DomInc<View>::propagate(Space& home, const ModEventDelta& med) {
+    if ((View::me(med) == ME_INT_VAL) && dc.available()) {
+      GECODE_ES_CHECK(dc.propagate_val(home));
+      return home.ES_FIX_PARTIAL(*this,View::med(ME_INT_DOM));
+    }
+    if (dc.available()) {
+      GECODE_ES_CHECK(dc.sync(home));
+    } else {
+      GECODE_ES_CHECK(dc.init(home,x.size(),&x[0]));
+    }
+    GECODE_ES_CHECK(dc.propagate(home));
+    return dc.empty() ? home.ES_SUBSUMED(*this) : ES_FIX;
+  }
+
+}}}
+
+// STATISTICS: int-prop
+
@@ -36,6 +36,7 @@
  */
 
 #include <climits>
+#include <cstdlib>
 
 namespace Gecode { namespace Int { namespace Distinct {
 
@@ -671,6 +672,8 @@ namespace Gecode { namespace Int { namespace Distinct {
     if (x.size() > 3) {
       // Do bounds propagation to make view-value graph smaller
       GECODE_ES_CHECK(prop_bnd<View>(home,x));
+      if (x.size() >= (getenv("DINC") ? atoi(getenv("DINC")) : 1000000))
+        return DomInc<View>::post(home,x);
       (void) new (home) Dom<View>(home,x);
     }
     return ES_OK;
@@ -129,6 +129,13 @@ namespace Gecode { namespace Int {
     NotYetFinalized(const char* l);
   };
 
+  /// %Exception: Tuple set file cannot be accessed
+  class GECODE_VTABLE_EXPORT TupleSetFileError : public Exception {
+  public:
+    /// Initialize with location \a l
+    TupleSetFileError(const char* l);
+  };
+
   //@}
 
 
@@ -190,6 +197,10 @@ namespace Gecode { namespace Int {
   NotYetFinalized::NotYetFinalized(const char* l)
     : Exception(l,"Tuple set not yet finalized") {}
 
+  inline
+  TupleSetFileError::TupleSetFileError(const char* l)
+    : Exception(l,"Tuple set file cannot be read or written") {}
+
 }}
 
 // STATISTICS: int-other
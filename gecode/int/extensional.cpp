@@ -78,6 +78,10 @@ namespace Gecode {
       GECODE_ES_FAIL((Extensional::Incremental<IntView>
                            ::post(home,xv,t)));
       break;
+    case EPK_COMPACT:
+      GECODE_ES_FAIL((Extensional::Compact<IntView>
+                           ::post(home,xv,t)));
+      break;
     default:
       if (x.same(home)) {
         GECODE_ES_FAIL((Extensional::Basic<IntView,true>
@@ -107,6 +111,10 @@ namespace Gecode {
       GECODE_ES_FAIL((Extensional::Incremental<BoolView>
                            ::post(home,xv,t)));
       break;
+    case EPK_COMPACT:
+      GECODE_ES_FAIL((Extensional::Compact<BoolView>
+                           ::post(home,xv,t)));
+      break;
     default:
       if (x.same(home)) {
         GECODE_ES_FAIL((Extensional::Basic<BoolView,true>
@@ -226,6 +226,7 @@ namespace Gecode { namespace Int { namespace Extensional {
 
   typedef TupleSet::Tuple Tuple;
   typedef Support::BitSetBase BitSet;
+  typedef Support::BitSetData BitSetData;
   typedef Support::BitSetBase* Domain;
 
   /**
@@ -243,7 +244,7 @@ namespace Gecode { namespace Int { namespace Extensional {
   protected:
     ViewArray<View> x; ///< Variables
     TupleSet tupleSet; ///< Definition of constraint
-    Tuple** last_data; ///< Last tuple looked at
+    unsigned int* last_data; ///< Position in index of last tuple looked at
     /// Access real tuple-set
     TupleSet::TupleSetI* ts(void);
 
@@ -252,7 +253,7 @@ namespace Gecode { namespace Int { namespace Extensional {
     /// Constructor for posting
     Base(Home home, ViewArray<View>& x, const TupleSet& t);
     /// Initialize last support
-    void init_last(Space& home, Tuple** source);
+    void init_last(Space& home, const unsigned int* source);
     /// Find last support for view at position \a i and value \a n
     Tuple last(int i, int n);
     /// Find last support for view at position \a i and value \a n
@@ -502,6 +503,88 @@ namespace Gecode { namespace Int { namespace Extensional {
 #include <gecode/int/extensional/incremental.hpp>
 
 
+namespace Gecode { namespace Int { namespace Extensional {
+
+  /**
+   * \brief Domain consistent extensional propagator based on compact tables
+   *
+   * The propagator maintains the set of tuples that are still valid
+   * as a sparse bitset: only words that still contain valid tuples
+   * are stored, so copying the propagator compacts the bitset. The
+   * valid tuples are updated with the support bitsets of the tuple
+   * set, which are precomputed for each variable and value, using
+   * word-level operations.
+   *
+   * The same view can occur multiply.
+   *
+   * Requires \code #include <gecode/int/extensional.hh> \endcode
+   * \ingroup FuncIntProp
+   */
+  template<class View>
+  class Compact : public Propagator {
+  protected:
+    /// %Advisor for a view (by position in array)
+    class CTAdvisor : public Advisor {
+    public:
+      /// Position of view
+      int i;
+      /// Create advisor for view at position \a i
+      CTAdvisor(Space& home, Propagator& p, Council<CTAdvisor>& c, int i);
+      /// Clone advisor \a a
+      CTAdvisor(Space& home, bool share, CTAdvisor& a);
+    };
+    /// Views
+    ViewArray<View> x;
+    /// Definition of constraint
+    TupleSet tupleSet;
+    /// The advisor council
+    Council<CTAdvisor> c;
+    /// Number of words still containing valid tuples
+    unsigned int n_words;
+    /// Words of valid tuples
+    BitSetData* words;
+    /// Original positions of the words
+    unsigned int* index;
+    /// Last position of a word with a support (per view and value)
+    unsigned int* residues;
+    /// Access real tuple-set
+    TupleSet::TupleSetI* ts(void);
+    /// Keep only the tuples in \a mask (indexed by original positions)
+    void intersect(const BitSetData* mask);
+    /// Keep only the tuples in \a mask (indexed by current positions)
+    void keep(const BitSetData* mask);
+    /// Remove the tuples in \a mask (indexed by current positions)
+    void remove(const BitSetData* mask);
+    /// Add the tuples of view \a i and value \a n to \a mask
+    void add(BitSetData* mask, int i, int n);
+    /// Test whether value \a n of view \a i is still supported
+    bool supported(int i, int n);
+    /// Update valid tuples for all values of view \a i
+    void reset(Space& home, int i);
+    /// Constructor for cloning \a p
+    Compact(Space& home, bool share, Compact<View>& p);
+    /// Constructor for posting
+    Compact(Home home, ViewArray<View>& x, const TupleSet& t);
+  public:
+    /// Cost function (defined as high linear)
+    virtual PropCost cost(const Space& home, const ModEventDelta& med) const;
+    /// Copy propagator during cloning
+    virtual Actor* copy(Space& home, bool share);
+    /// Give advice to propagator
+    virtual ExecStatus advise(Space& home, Advisor& a, const Delta& d);
+    /// Perform propagation
+    virtual ExecStatus propagate(Space& home, const ModEventDelta& med);
+    /// Delete propagator and return its size
+    virtual size_t dispose(Space& home);
+    /// Post propagator for views \a x
+    static ExecStatus post(Home home, ViewArray<View>& x, const TupleSet& t);
+  };
+
+}}}
+
+#include <gecode/int/extensional/compact.hpp>
+
+
 #endif
 
 // STATISTICS: int-prop
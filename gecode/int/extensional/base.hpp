@@ -71,10 +71,10 @@ namespace Gecode { namespace Int { namespace Extensional {
 
   template<class View, bool subscribe>
   forceinline void
-  Base<View,subscribe>::init_last(Space& home, Tuple** source) {
+  Base<View,subscribe>::init_last(Space& home, const unsigned int* source) {
     if (last_data == NULL) {
       int literals = static_cast<int>(ts()->domsize*x.size());
-      last_data = home.alloc<Tuple*>(literals);
+      last_data = home.alloc<unsigned int>(literals);
       for (int i = literals; i--; )
         last_data[i] = source[i];
     }
@@ -92,7 +92,7 @@ namespace Gecode { namespace Int { namespace Extensional {
     return PropCost::quadratic(PropCost::HI,x.size());
   }
 
-#define GECODE_LAST_TUPLE(l) (*(l))
+#define GECODE_LAST_TUPLE(l) (ts()->tuple(ts()->index[l]))
 
   template<class View, bool subscribe>
   forceinline Tuple
@@ -108,7 +108,7 @@ namespace Gecode { namespace Int { namespace Extensional {
     int pos = (i*static_cast<int>(ts()->domsize)) + n;
     ++(last_data[pos]);
     if (last(i,n)[i] != (n+ts()->min))
-      last_data[pos] = ts()->nullpointer;
+      last_data[pos] = ts()->end();
     return last(i,n);
   }
 
@@ -152,7 +152,7 @@ namespace Gecode { namespace Int { namespace Extensional {
       x.cancel(home,*this,PC_INT_DOM);
     // take care of last_data
     unsigned int literals = ts()->domsize*x.size();
-    home.rfree(last_data, sizeof(Tuple*)*literals);
+    home.rfree(last_data, sizeof(unsigned int)*literals);
     (void) tupleSet.~TupleSet();
     return sizeof(*this);
   }
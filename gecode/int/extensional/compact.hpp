@@ -0,0 +1,290 @@
+/* -*- mode: C++; c-basic-offset: 2; indent-tabs-mode: nil -*- */
+/*
+ *  Main authors:
+ *     Christian Schulte <schulte@gecode.org>
+ *
+ *  Copyright:
+ *     Christian Schulte, 2011
+ *
+ *  Last modified:
+ *     $Date$ by $Author$
+ *     $Revision$
+ *
+ *  This file is part of Gecode, the generic constraint
+ *  development environment:
+ *     http://www.gecode.org
+ *
+ *  Permission is hereby granted, free of charge, to any person obtaining
+ *  a copy of this software and associated documentation files (the
+ *  "Software"), to deal in the Software without restriction, including
+ *  without limitation the rights to use, copy, modify, merge, publish,
+ *  distribute, sublicense, and/or sell copies of the Software, and to
+ *  permit persons to whom the Software is furnished to do so, subject to
+ *  the following conditions:
+ *
+ *  The above copyright notice and this permission notice shall be
+ *  included in all copies or substantial portions of the Software.
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ *  EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ *  MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ *  NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE
+ *  LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+ *  OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+ *  WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ */
+
+namespace Gecode { namespace Int { namespace Extensional {
+
+  /*
+   * Advisor
+   *
+   */
+  template<class View>
+  forceinline
+  Compact<View>::CTAdvisor::CTAdvisor(Space& home, Propagator& p,
+                                      Council<CTAdvisor>& c, int i0)
+    : Advisor(home,p,c), i(i0) {}
+
+  template<class View>
+  forceinline
+  Compact<View>::CTAdvisor::CTAdvisor(Space& home, bool share, CTAdvisor& a)
+    : Advisor(home,share,a), i(a.i) {}
+
+
+  /*
+   * Operations on valid tuples
+   *
+   */
+  template<class View>
+  forceinline TupleSet::TupleSetI*
+  Compact<View>::ts(void) {
+    return tupleSet.implementation();
+  }
+
+  template<class View>
+  forceinline void
+  Compact<View>::intersect(const BitSetData* mask) {
+    for (unsigned int k = n_words; k--; ) {
+      words[k].a(mask[index[k]]);
+      if (words[k].none()) {
+        // Replace by last word (which has been processed already)
+        n_words--;
+        words[k] = words[n_words]; index[k] = index[n_words];
+      }
+    }
+  }
+
+  template<class View>
+  forceinline void
+  Compact<View>::keep(const BitSetData* mask) {
+    for (unsigned int k = n_words; k--; ) {
+      words[k].a(mask[k]);
+      if (words[k].none()) {
+        n_words--;
+        words[k] = words[n_words]; index[k] = index[n_words];
+      }
+    }
+  }
+
+  template<class View>
+  forceinline void
+  Compact<View>::remove(const BitSetData* mask) {
+    for (unsigned int k = n_words; k--; ) {
+      words[k].d(mask[k]);
+      if (words[k].none()) {
+        n_words--;
+        words[k] = words[n_words]; index[k] = index[n_words];
+      }
+    }
+  }
+
+  template<class View>
+  forceinline void
+  Compact<View>::add(BitSetData* mask, int i, int n) {
+    const BitSetData* s = ts()->support(i,n);
+    for (unsigned int k = n_words; k--; )
+      mask[k].o(s[index[k]]);
+  }
+
+  template<class View>
+  forceinline bool
+  Compact<View>::supported(int i, int n) {
+    const BitSetData* s = ts()->support(i,n);
+    unsigned int& r = residues[static_cast<unsigned int>(i)*ts()->domsize + 
+                               static_cast<unsigned int>(n - ts()->min)];
+    // Words are moved when copying or removing words, so the residue
+    // is only a hint
+    if ((r < n_words) && !BitSetData::a(words[r],s[index[r]]).none())
+      return true;
+    for (unsigned int k = 0; k < n_words; k++)
+      if (!BitSetData::a(words[k],s[index[k]]).none()) {
+        r = k; return true;
+      }
+    return false;
+  }
+
+  template<class View>
+  forceinline void
+  Compact<View>::reset(Space& home, int i) {
+    Region r(home);
+    BitSetData* mask = r.alloc<BitSetData>(n_words);
+    for (unsigned int k = n_words; k--; )
+      mask[k].init();
+    for (ViewValues<View> vv(x[i]); vv(); ++vv)
+      add(mask,i,vv.val());
+    keep(mask);
+  }
+
+
+  /*
+   * The propagator proper
+   *
+   */
+  template<class View>
+  forceinline
+  Compact<View>::Compact(Home h, ViewArray<View>& x0, const TupleSet& t)
+    : Propagator(h), x(x0), tupleSet(t), c(h) {
+    Space& home = h;
+    ts()->init_supports();
+    // Initially all tuples are valid
+    n_words = ts()->words;
+    words = home.alloc<BitSetData>(n_words);
+    index = home.alloc<unsigned int>(n_words);
+    for (unsigned int k = n_words; k--; ) {
+      words[k].init(); index[k] = k;
+    }
+    for (int j = ts()->size-1; j--; )
+      words[static_cast<unsigned int>(j) / BitSetData::bpb]
+        .set(static_cast<unsigned int>(j) % BitSetData::bpb);
+    unsigned int literals = ts()->domsize*static_cast<unsigned int>(x.size());
+    residues = home.alloc<unsigned int>(literals);
+    for (unsigned int l = literals; l--; )
+      residues[l] = 0;
+    // Only keep tuples that are valid for the current domains
+    for (int i = x.size(); i--; ) {
+      reset(home,i);
+      if (!x[i].assigned())
+        x[i].subscribe(home,*new (home) CTAdvisor(home,*this,c,i));
+    }
+    home.notice(*this,AP_DISPOSE);
+    // Boolean views only honor assignment events for scheduling
+    View::schedule(home,*this,ME_INT_VAL);
+  }
+
+  template<class View>
+  ExecStatus
+  Compact<View>::post(Home home, ViewArray<View>& x, const TupleSet& t) {
+    if (t.tuples() == 0)
+      return ES_FAILED;
+    // All variables in the correct domain
+    for (int i = x.size(); i--; ) {
+      GECODE_ME_CHECK(x[i].gq(home, t.min()));
+      GECODE_ME_CHECK(x[i].lq(home, t.max()));
+    }
+    (void) new (home) Compact<View>(home,x,t);
+    return ES_OK;
+  }
+
+  template<class View>
+  forceinline
+  Compact<View>::Compact(Space& home, bool share, Compact<View>& p)
+    : Propagator(home,share,p), n_words(p.n_words) {
+    x.update(home,share,p.x);
+    tupleSet.update(home,share,p.tupleSet);
+    c.update(home,share,p.c);
+    // Only the words still containing valid tuples are copied
+    words = home.alloc<BitSetData>(n_words);
+    index = home.alloc<unsigned int>(n_words);
+    for (unsigned int k = n_words; k--; ) {
+      words[k] = p.words[k]; index[k] = p.index[k];
+    }
+    unsigned int literals = ts()->domsize*static_cast<unsigned int>(x.size());
+    residues = home.alloc<unsigned int>(literals);
+    for (unsigned int l = literals; l--; )
+      residues[l] = p.residues[l];
+  }
+
+  template<class View>
+  Actor*
+  Compact<View>::copy(Space& home, bool share) {
+    return new (home) Compact<View>(home,share,*this);
+  }
+
+  template<class View>
+  PropCost
+  Compact<View>::cost(const Space&, const ModEventDelta&) const {
+    return PropCost::linear(PropCost::HI,x.size());
+  }
+
+  template<class View>
+  size_t
+  Compact<View>::dispose(Space& home) {
+    home.ignore(*this,AP_DISPOSE);
+    c.dispose(home);
+    (void) tupleSet.~TupleSet();
+    (void) Propagator::dispose(home);
+    return sizeof(*this);
+  }
+
+  template<class View>
+  ExecStatus
+  Compact<View>::advise(Space& home, Advisor& _a, const Delta& d) {
+    CTAdvisor& a = static_cast<CTAdvisor&>(_a);
+    int i = a.i;
+    if (x[i].assigned()) {
+      intersect(ts()->support(i,x[i].val()));
+    } else if (!x[i].any(d) && 
+               (static_cast<unsigned int>(x[i].max(d)-x[i].min(d)) 
+                < x[i].size())) {
+      // Remove the tuples for the few values that have been removed
+      Region r(home);
+      BitSetData* mask = r.alloc<BitSetData>(n_words);
+      for (unsigned int k = n_words; k--; )
+        mask[k].init();
+      for (int n = std::max(x[i].min(d),ts()->min); 
+           n <= std::min(x[i].max(d),ts()->max); n++)
+        add(mask,i,n);
+      remove(mask);
+    } else {
+      reset(home,i);
+    }
+    if (n_words == 0)
+      return ES_FAILED;
+    if (x[i].assigned())
+      return home.ES_NOFIX_DISPOSE(c,a);
+    return ES_NOFIX;
+  }
+
+  template<class View>
+  ExecStatus
+  Compact<View>::propagate(Space& home, const ModEventDelta&) {
+    Region r(home);
+    // Values to prune
+    Support::StaticStack<int,Region> nq(r,static_cast<int>(ts()->domsize));
+    // Pruning a view updates the valid tuples through its advisor
+    bool pruned;
+    do {
+      pruned = false;
+      for (int i = x.size(); i--; ) {
+        for (ViewValues<View> vv(x[i]); vv(); ++vv)
+          if (!supported(i,vv.val()))
+            nq.push(vv.val());
+        if (!nq.empty()) {
+          pruned = true;
+          while (!nq.empty())
+            GECODE_ME_CHECK(x[i].nq(home,nq.pop()));
+        }
+      }
+    } while (pruned);
+
+    for (int i = x.size(); i--; )
+      if (!x[i].assigned())
+        return ES_FIX;
+    return home.ES_SUBSUMED(*this);
+  }
+
+}}}
+
+// STATISTICS: int-prop
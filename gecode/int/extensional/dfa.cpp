@@ -140,6 +140,56 @@ namespace Gecode { namespace Int { namespace Extensional {
     StateGroup* lst;
   };
 
+  /**
+   * \brief Node of a decision diagram during its construction
+   *
+   * A node corresponds to all tuples that share a prefix, its
+   * outgoing edges are given by a range of symbols and target states.
+   */
+  class MDDNode {
+  public:
+    int fst;   ///< First outgoing edge
+    int lst;   ///< Last outgoing edge (exclusive)
+    int tuple; ///< First tuple with the prefix of this node
+    int state; ///< State assigned to this node
+  };
+
+  /**
+   * \brief Sort nodes of a decision diagram by their outgoing edges
+   */
+  class MDDNodeByEdges {
+  private:
+    /// Symbols of edges
+    const int* sym;
+    /// Target states of edges
+    const int* dst;
+  public:
+    /// Initialize with edge symbols \a s and target states \a d
+    forceinline
+    MDDNodeByEdges(const int* s, const int* d) : sym(s), dst(d) {}
+    /// Test whether \a x and \a y have the same outgoing edges
+    forceinline bool
+    same(const MDDNode& x, const MDDNode& y) const {
+      if (x.lst-x.fst != y.lst-y.fst)
+        return false;
+      for (int i = x.fst, j = y.fst; i < x.lst; i++, j++)
+        if ((sym[i] != sym[j]) || (dst[i] != dst[j]))
+          return false;
+      return true;
+    }
+    forceinline bool
+    operator ()(const MDDNode& x, const MDDNode& y) {
+      if (x.lst-x.fst != y.lst-y.fst)
+        return x.lst-x.fst < y.lst-y.fst;
+      for (int i = x.fst, j = y.fst; i < x.lst; i++, j++)
+        if (sym[i] != sym[j])
+          return sym[i] < sym[j];
+        else if (dst[i] != dst[j])
+          return dst[i] < dst[j];
+      return false;
+    }
+  };
+
   /// Information about states
   enum StateInfo {
     SI_NONE       = 0, ///< State is not reachable
@@ -153,6 +203,99 @@ namespace Gecode { namespace Int { namespace Extensional {
 namespace Gecode {
 
   DFA::DFA(int start, Transition t_spec[], int f_spec[], bool minimize) {
+    init(start, t_spec, f_spec, minimize);
+  }
+
+  DFA::DFA(const TupleSet& ts) {
+    using namespace Int;
+    using namespace Extensional;
+    int n = ts.arity();
+    int m = ts.tuples();
+    // Finalized tuples are sorted lexicographically: tuples sharing a
+    // prefix are adjacent and each prefix corresponds to a node
+
+    // Position where a tuple differs first from its predecessor
+    int* diff = heap.alloc<int>(std::max(m,1));
+    for (int t = 1; t < m; t++) {
+      int i = 0;
+      while ((i < n) && (ts[t-1][i] == ts[t][i]))
+        i++;
+      diff[t] = i;
+    }
+    diff[0] = -1;
+
+    // State of the node reached by a tuple on the layer below
+    int* node = heap.alloc<int>(std::max(m,1));
+    // The only final state is zero
+    for (int t = m; t--; )
+      node[t] = 0;
+    int n_states = 1;
+
+    // Edges and nodes of a layer
+    int* sym = heap.alloc<int>(std::max(m,1));
+    int* dst = heap.alloc<int>(std::max(m,1));
+    MDDNode* nodes = heap.alloc<MDDNode>(std::max(m,1));
+    // All transitions (plus one for marking the end)
+    Transition* trans = heap.alloc<Transition>(n*m+1);
+    int n_trans = 0;
+
+    // Build the layers bottom-up, sharing nodes with the same edges
+    for (int i = n; i--; ) {
+      int n_nodes = 0, n_edges = 0;
+      for (int t = 0; t < m; t++) {
+        if (diff[t] < i) {
+          nodes[n_nodes].fst = n_edges;
+          nodes[n_nodes].tuple = t;
+          n_nodes++;
+        }
+        if (diff[t] <= i) {
+          sym[n_edges] = ts[t][i];
+          dst[n_edges] = node[t];
+          n_edges++;
+        }
+        nodes[n_nodes-1].lst = n_edges;
+      }
+      MDDNodeByEdges mbe(sym,dst);
+      Support::quicksort<MDDNode,MDDNodeByEdges>(nodes,n_nodes,mbe);
+      for (int k = 0; k < n_nodes; k++)
+        if ((k > 0) && mbe.same(nodes[k-1],nodes[k])) {
+          nodes[k].state = nodes[k-1].state;
+        } else {
+          nodes[k].state = n_states++;
+          for (int e = nodes[k].fst; e < nodes[k].lst; e++) {
+            trans[n_trans].i_state = nodes[k].state;
+            trans[n_trans].symbol  = sym[e];
+            trans[n_trans].o_state = dst[e];
+            n_trans++;
+          }
+        }
+      // Record nodes for the layer above
+      for (int k = n_nodes; k--; ) {
+        int t = nodes[k].tuple;
+        do {
+          node[t++] = nodes[k].state;
+        } while ((t < m) && (diff[t] >= i));
+      }
+    }
+    trans[n_trans].i_state = -1;
+    trans[n_trans].symbol  = 0;
+    trans[n_trans].o_state = -1;
+
+    // Without tuples, the start state has no transitions
+    int start = (m > 0) ? node[0] : n_states;
+    int final[2] = {0, -1};
+    init(start, trans, final, false);
+
+    heap.free<Transition>(trans,n*m+1);
+    heap.free<MDDNode>(nodes,std::max(m,1));
+    heap.free<int>(dst,std::max(m,1));
+    heap.free<int>(sym,std::max(m,1));
+    heap.free<int>(node,std::max(m,1));
+    heap.free<int>(diff,std::max(m,1));
+  }
+
+  void
+  DFA::init(int start, Transition t_spec[], int f_spec[], bool minimize) {
     using namespace Int;
     using namespace Extensional;
     // Compute number of states and transitions
@@ -37,6 +37,17 @@
 
 #include <gecode/int.hh>
 
+#include <cstdio>
+#include <cstring>
+
+#ifdef GECODE_HAS_MMAP
+#include <sys/types.h>
+#include <sys/stat.h>
+#include <sys/mman.h>
+#include <fcntl.h>
+#include <unistd.h>
+#endif
+
 namespace {
 
   typedef ::Gecode::TupleSet::Tuple Tuple;
@@ -88,14 +99,68 @@ namespace {
     }
   };
 
+  /// Header of a tuple set file
+  struct TupleSetFileHeader {
+    /// Magic characters identifying a tuple set file
+    char magic[8];
+    /// Version of file format
+    unsigned int version;
+    /// Value for checking byte order and integer size
+    unsigned int check;
+    /// Arity
+    int arity;
+    /// Number of tuples (including the final largest tuple)
+    int size;
+    /// Minimum and maximum in domain-values
+    int min, max;
+    /// Domain size
+    unsigned int domsize;
+  };
+
+  /// Magic characters of a tuple set file
+  const char tuple_set_magic[8] = {'G','e','c','o','d','e','T','S'};
+  /// Version of tuple set file format
+  const unsigned int tuple_set_version = 1;
+  /// Value for checking byte order and integer size
+  const unsigned int tuple_set_check = 0x01020304U;
+
 }
 
 namespace Gecode {
 
+  /// Storage shared by all copies of a tuple set read from a file
+  class TupleSet::TupleSetI::Mapping {
+  public:
+    /// Start of storage
+    void* p;
+    /// Size of storage in bytes
+    size_t n;
+    /// Number of tuple sets using the storage
+    volatile unsigned long int use_cnt;
+    /// Initialize with storage \a p0 of size \a n0
+    Mapping(void* p0, size_t n0) : p(p0), n(n0), use_cnt(1) {}
+    /// Add a user of the storage
+    void subscribe(void) {
+      (void) Support::Atomic::inc(use_cnt);
+    }
+    /// Remove a user of the storage, return true if it was the last one
+    bool cancel(void) {
+      return Support::Atomic::dec(use_cnt) == 0;
+    }
+    /// Release storage
+    ~Mapping(void) {
+#ifdef GECODE_HAS_MMAP
+      (void) ::munmap(p,n);
+#else
+      heap.rfree(p);
+#endif
+    }
+  };
+
   void
   TupleSet::TupleSetI::finalize(void) {
     assert(!finalized());
-    assert(tuples == NULL);
+    assert(index == NULL);
 
     // Add final largest tuple
     IntArgs ia(arity);
@@ -108,52 +173,51 @@ namespace Gecode {
     // Domainsize
     domsize = static_cast<unsigned int>(max - min) + 1;
 
-    // Allocate tuple indexing data-structures
-    tuples = heap.alloc<Tuple*>(arity);
-    tuple_data = heap.alloc<Tuple>(size*arity+1);
-    tuple_data[size*arity] = NULL;
-    nullpointer = tuple_data+(size*arity);
-
-    // Rearrange the tuples for faster comparisons.
-    for (int i = arity; i--; )
-      tuples[i] = tuple_data + (i * size);
-    for (int i = size; i--; )
-      tuples[0][i] = data + (i * arity);
+    // Sort the tuples for faster comparisons.
+    Tuple* tuples = heap.alloc<Tuple>(size);
+    for (int t = size; t--; )
+      tuples[t] = data + (t * arity);
 
     FullTupleCompare ftc(arity);
-    Support::quicksort(tuples[0], size, ftc);
-    assert(tuples[0][size-1][0] == ia[0]);
+    Support::quicksort(tuples, size, ftc);
+    assert(tuples[size-1][0] == ia[0]);
     int* new_data = heap.alloc<int>(size*arity);
     for (int t = size; t--; )
       for (int i = arity; i--; )
-        new_data[t*arity + i] = tuples[0][t][i];
+        new_data[t*arity + i] = tuples[t][i];
 
     heap.rfree(data);
     data = new_data;
     excess = -1;
 
     // Set up indexing structure
-    for (int i = arity; i--; )
-      for (int t = size; t--; )
-        tuples[i][t] = data + (t * arity);
+    index = heap.alloc<unsigned int>(size*arity+1);
+    index[end()] = static_cast<unsigned int>(size);
+    for (int t = size; t--; )
+      index[t] = static_cast<unsigned int>(t);
     for (int i = arity; i-->1; ) {
+      for (int t = size; t--; )
+        tuples[t] = data + (t * arity);
       TuplePosCompare tpc(i);
-      Support::quicksort(tuples[i], size, tpc);
+      Support::quicksort(tuples, size, tpc);
+      for (int t = size; t--; )
+        index[i*size + t] = static_cast<unsigned int>((tuples[t]-data) / arity);
     }
+    heap.rfree(tuples);
 
     // Set up initial last-structure
-    last = heap.alloc<Tuple*>(domsize*arity);
+    last = heap.alloc<unsigned int>(domsize*arity);
     for (int i = arity; i--; ) {
-      Tuple* t = tuples[i];
+      // The final largest tuple guarantees that the scan stays in the block
+      unsigned int p = static_cast<unsigned int>(i*size);
       for (unsigned int d = 0; d < domsize; ++d) {
-        while (t && *t && (*t)[i] < static_cast<int>(min+d)) {
-          ++t;
-        }
-        if (t && *t && (*t)[i] == static_cast<int>(min+d)) {
-          last[(i*domsize) + d] = t;
-          ++t;
+        while (tuple(index[p])[i] < static_cast<int>(min+d))
+          ++p;
+        if (tuple(index[p])[i] == static_cast<int>(min+d)) {
+          last[(i*domsize) + d] = p;
+          ++p;
         } else {
-          last[(i*domsize) + d] = nullpointer;
+          last[(i*domsize) + d] = end();
         }
       }
     }
@@ -161,6 +225,29 @@ namespace Gecode {
     assert(finalized());
   }
 
+  void
+  TupleSet::TupleSetI::init_supports(void) {
+    assert(finalized());
+    if (supports != NULL)
+      return;
+    // The final largest tuple is not included
+    int n = size-1;
+    words = Support::BitSetData::data(static_cast<unsigned int>(n));
+    unsigned int s = static_cast<unsigned int>(arity) * domsize * words;
+    supports = heap.alloc<Support::BitSetData>(s);
+    for (unsigned int i = s; i--; )
+      supports[i].init();
+    const unsigned int bpb = Support::BitSetData::bpb;
+    for (int t = n; t--; )
+      for (int i = arity; i--; ) {
+        unsigned int p = (static_cast<unsigned int>(i)*domsize + 
+                          static_cast<unsigned int>(data[t*arity+i]-min))
+          * words;
+        supports[p + static_cast<unsigned int>(t) / bpb]
+          .set(static_cast<unsigned int>(t) % bpb);
+      }
+  }
+
   void
   TupleSet::TupleSetI::resize(void) {
     assert(excess == 0);
@@ -179,44 +266,169 @@ namespace Gecode {
     d->min        = min;
     d->max        = max;
     d->domsize    = domsize;
+    d->words      = words;
 
-    // Table data
-    d->data = heap.alloc<int>(size*arity);
-    heap.copy(&d->data[0], &data[0], size*arity);
+    if (mapping != NULL) {
+      // Share the read-only storage
+      mapping->subscribe();
+      d->mapping = mapping;
+      d->data    = data;
+      d->index   = index;
+      d->last    = last;
+    } else {
+      // Table data
+      d->data = heap.alloc<int>(size*arity);
+      heap.copy(d->data, data, size*arity);
 
-    // Indexing data
-    d->tuples = heap.alloc<Tuple*>(arity);
-    d->tuple_data = heap.alloc<Tuple>(size*arity+1);
-    d->tuple_data[size*arity] = NULL;
-    d->nullpointer = d->tuple_data+(size*arity);
+      // Indexing data
+      d->index = heap.alloc<unsigned int>(size*arity+1);
+      heap.copy(d->index, index, size*arity+1);
 
-    // Rearrange the tuples for faster comparisons.
-    for (int i = arity; i--; )
-      d->tuples[i] = d->tuple_data + (i * size);
-    for (int a = arity; a--; ) {
-      for (int i = size; i--; ) {
-        d->tuples[a][i] = d->data + (tuples[a][i]-data);
-      }
+      // Last data
+      d->last = heap.alloc<unsigned int>(domsize*arity);
+      heap.copy(d->last, last, domsize*arity);
     }
 
-    // Last data
-    d->last = heap.alloc<Tuple*>(domsize*arity);
-    for (int i = static_cast<int>(domsize)*arity; i--; ) {
-      d->last[i] = d->tuple_data + (last[i]-tuple_data);
+    // Support bitsets
+    if (supports != NULL) {
+      unsigned int s = static_cast<unsigned int>(arity) * domsize * words;
+      d->supports = heap.alloc<Support::BitSetData>(s);
+      heap.copy(d->supports, supports, s);
     }
 
     return d;
   }
 
+  void
+  TupleSet::TupleSetI::load(const std::string& fn) {
+    assert((mapping == NULL) && (data == NULL));
+#ifdef GECODE_HAS_MMAP
+    int fd = ::open(fn.c_str(), O_RDONLY);
+    if (fd < 0)
+      throw Int::TupleSetFileError("TupleSet::TupleSet");
+    struct stat st;
+    if ((::fstat(fd, &st) != 0) ||
+        (static_cast<size_t>(st.st_size) < sizeof(TupleSetFileHeader))) {
+      (void) ::close(fd);
+      throw Int::TupleSetFileError("TupleSet::TupleSet");
+    }
+    size_t n = static_cast<size_t>(st.st_size);
+    void* p = ::mmap(NULL, n, PROT_READ, MAP_SHARED, fd, 0);
+    (void) ::close(fd);
+    if (p == MAP_FAILED)
+      throw Int::TupleSetFileError("TupleSet::TupleSet");
+#else
+    std::FILE* f = std::fopen(fn.c_str(), "rb");
+    if (f == NULL)
+      throw Int::TupleSetFileError("TupleSet::TupleSet");
+    long int l = -1;
+    if (std::fseek(f, 0, SEEK_END) == 0) {
+      l = std::ftell(f);
+      std::rewind(f);
+    }
+    if ((l < 0) || (static_cast<size_t>(l) < sizeof(TupleSetFileHeader))) {
+      (void) std::fclose(f);
+      throw Int::TupleSetFileError("TupleSet::TupleSet");
+    }
+    size_t n = static_cast<size_t>(l);
+    void* p = heap.ralloc(n);
+    if (std::fread(p, 1, n, f) != n) {
+      heap.rfree(p);
+      (void) std::fclose(f);
+      throw Int::TupleSetFileError("TupleSet::TupleSet");
+    }
+    (void) std::fclose(f);
+#endif
+    // From now on the storage is released by the destructor
+    mapping = new Mapping(p,n);
+
+    const TupleSetFileHeader* h = static_cast<const TupleSetFileHeader*>(p);
+    if ((std::memcmp(h->magic, tuple_set_magic, sizeof(h->magic)) != 0) ||
+        (h->version != tuple_set_version) || 
+        (h->check != tuple_set_check) ||
+        (h->arity <= 0) || (h->size <= 0) || (h->min > h->max) ||
+        (h->domsize != static_cast<unsigned int>(h->max - h->min) + 1))
+      throw Int::TupleSetFileError("TupleSet::TupleSet");
+    size_t m = static_cast<size_t>(h->size) * static_cast<size_t>(h->arity);
+    if (n != sizeof(TupleSetFileHeader) + sizeof(int)*m + 
+        sizeof(unsigned int)*(m+1) +
+        sizeof(unsigned int)*h->domsize*static_cast<size_t>(h->arity))
+      throw Int::TupleSetFileError("TupleSet::TupleSet");
+
+    arity   = h->arity;
+    size    = h->size;
+    min     = h->min;
+    max     = h->max;
+    domsize = h->domsize;
+    excess  = -1;
+    // The arrays follow the header, the storage must not be modified
+    char* s = static_cast<char*>(p) + sizeof(TupleSetFileHeader);
+    data    = reinterpret_cast<int*>(s);
+    index   = reinterpret_cast<unsigned int*>(s + sizeof(int)*m);
+    last    = index + (m+1);
+    if (index[end()] != static_cast<unsigned int>(size))
+      throw Int::TupleSetFileError("TupleSet::TupleSet");
+    assert(finalized());
+  }
+
   TupleSet::TupleSetI::~TupleSetI(void) {
     excess = -2;
-    heap.rfree(tuples);
-    heap.rfree(tuple_data);
-    heap.rfree(data);
-    heap.rfree(last);
+    if (mapping != NULL) {
+      if (mapping->cancel())
+        delete mapping;
+    } else {
+      heap.rfree(index);
+      heap.rfree(data);
+      heap.rfree(last);
+    }
+    if (supports != NULL)
+      heap.rfree(supports);
+  }
+
+
+  TupleSet::TupleSet(const std::string& fn) {
+    TupleSetI* imp = new TupleSetI;
+    try {
+      imp->load(fn);
+    } catch (...) {
+      delete imp;
+      throw;
+    }
+    object(imp);
+  }
+
+  void
+  TupleSet::save(const std::string& fn) const {
+    TupleSetI* imp = static_cast<TupleSetI*>(object());
+    if ((imp == NULL) || !imp->finalized())
+      throw Int::NotYetFinalized("TupleSet::save");
+    TupleSetFileHeader h;
+    std::memcpy(h.magic, tuple_set_magic, sizeof(h.magic));
+    h.version = tuple_set_version;
+    h.check   = tuple_set_check;
+    h.arity   = imp->arity;
+    h.size    = imp->size;
+    h.min     = imp->min;
+    h.max     = imp->max;
+    h.domsize = imp->domsize;
+    std::FILE* f = std::fopen(fn.c_str(), "wb");
+    if (f == NULL)
+      throw Int::TupleSetFileError("TupleSet::save");
+    size_t m = static_cast<size_t>(imp->size) * 
+      static_cast<size_t>(imp->arity);
+    size_t l = static_cast<size_t>(imp->domsize) * 
+      static_cast<size_t>(imp->arity);
+    bool ok =
+      (std::fwrite(&h, sizeof(h), 1, f) == 1) &&
+      (std::fwrite(imp->data, sizeof(int), m, f) == m) &&
+      (std::fwrite(imp->index, sizeof(unsigned int), m+1, f) == m+1) &&
+      (std::fwrite(imp->last, sizeof(unsigned int), l, f) == l);
+    if (std::fclose(f) != 0)
+      ok = false;
+    if (!ok)
+      throw Int::TupleSetFileError("TupleSet::save");
   }
 
 }
 
 // STATISTICS: int-prop
-
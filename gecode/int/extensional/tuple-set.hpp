@@ -50,17 +50,38 @@ namespace Gecode {
   TupleSet::TupleSetI::TupleSetI(void)
     : arity(-1),
       size(0),
-      tuples(NULL),
-      tuple_data(NULL),
+      index(NULL),
       data(NULL),
       excess(0),
       min(Int::Limits::max),
       max(Int::Limits::min),
       domsize(0),
       last(NULL),
-      nullpointer(NULL)
+      words(0),
+      supports(NULL),
+      mapping(NULL)
   {}
 
+  forceinline const Support::BitSetData*
+  TupleSet::TupleSetI::support(int i, int n) const {
+    assert(supports != NULL);
+    assert((n >= min) && (n <= max));
+    return supports + 
+      ((static_cast<unsigned int>(i)*domsize + 
+        static_cast<unsigned int>(n-min)) * words);
+  }
+
+  forceinline TupleSet::Tuple
+  TupleSet::TupleSetI::tuple(unsigned int t) const {
+    assert(t <= static_cast<unsigned int>(size));
+    return (t == static_cast<unsigned int>(size)) ? NULL : data + t*arity;
+  }
+
+  forceinline unsigned int
+  TupleSet::TupleSetI::end(void) const {
+    return static_cast<unsigned int>(size*arity);
+  }
+
 
   template<class T>
   void
@@ -764,6 +764,119 @@ namespace Gecode { namespace Int { namespace Linear {
 #include <gecode/int/linear/int-nary.hpp>
 #include <gecode/int/linear/int-dom.hpp>
 
+namespace Gecode { namespace Int { namespace Linear {
+
+  /*
+   * n-ary propagators for many views
+   *
+   */
+
+  /// Minimal number of views for which LargeEq and LargeLq are used
+  const int large_n = 256;
+
+  /**
+   * \brief Base-class for n-ary linear propagators with many views
+   *
+   * The propagator implements \f$\sum_{i=0}^{|x|-1}a_i\cdot x_i\sim c\f$
+   * for non-zero coefficients \f$a_i\f$. Rather than accessing the
+   * bounds of scale views over and over again, the coefficients and
+   * the bounds of all terms \f$a_i\cdot x_i\f$ are kept in flat arrays
+   * and are only refreshed once per propagation. All sums and tests
+   * are then computed by simple loops over these arrays (which can be
+   * vectorized by the compiler) and only the bounds of views that
+   * actually change are written back.
+   *
+   * All computations use 64-bit integers. The propagator must only be
+   * posted if the sum of the absolute values of all terms cannot
+   * exceed Limits::double_max, which rules out any overflow.
+   */
+  class LargeLin : public Propagator {
+  protected:
+    /// The views
+    ViewArray<IntView> x;
+    /// The coefficients
+    int* a;
+    /// The smallest values of the terms \f$a_i\cdot x_i\f$
+    long long int* l;
+    /// The largest values of the terms \f$a_i\cdot x_i\f$
+    long long int* u;
+    /// Constant value
+    long long int c;
+    /// Constructor for cloning \a p
+    LargeLin(Space& home, bool share, LargeLin& p);
+    /// Constructor for creation
+    LargeLin(Home home, ViewArray<IntView>& x, const IntArgs& a,
+             long long int c);
+    /**
+     * \brief Refresh bounds of terms and eliminate assigned views
+     *
+     * Returns the sum of the smallest values \a sl and of the largest
+     * values \a su of all terms.
+     */
+    void bounds(long long int& sl, long long int& su);
+    /// Return the largest difference between the bounds of all terms
+    long long int width(void) const;
+    /// Restrict term \a i to be at most \a v, return false on failure
+    bool lq(Space& home, int i, long long int v);
+    /// Restrict term \a i to be at least \a v, return false on failure
+    bool gq(Space& home, int i, long long int v);
+  public:
+    /// Cost function (defined as low linear)
+    virtual PropCost cost(const Space& home, const ModEventDelta& med) const;
+    /// Delete propagator and return its size
+    virtual size_t dispose(Space& home);
+  };
+
+  /**
+   * \brief %Propagator for bounds consistent n-ary linear equality with many views
+   *
+   * Requires \code #include <gecode/int/linear.hh> \endcode
+   * \ingroup FuncIntProp
+   */
+  class LargeEq : public LargeLin {
+  protected:
+    /// Constructor for cloning \a p
+    LargeEq(Space& home, bool share, LargeEq& p);
+    /// Constructor for creation
+    LargeEq(Home home, ViewArray<IntView>& x, const IntArgs& a,
+            long long int c);
+  public:
+    /// Create copy during cloning
+    virtual Actor* copy(Space& home, bool share);
+    /// Perform propagation
+    virtual ExecStatus propagate(Space& home, const ModEventDelta& med);
+    /// Post propagator for \f$\sum_{i=0}^{|x|-1}a_i\cdot x_i=c\f$
+    static ExecStatus post(Home home, ViewArray<IntView>& x,
+                           const IntArgs& a, long long int c);
+  };
+
+  /**
+   * \brief %Propagator for bounds consistent n-ary linear less or equal with many views
+   *
+   * Requires \code #include <gecode/int/linear.hh> \endcode
+   * \ingroup FuncIntProp
+   */
+  class LargeLq : public LargeLin {
+  protected:
+    /// Constructor for cloning \a p
+    LargeLq(Space& home, bool share, LargeLq& p);
+    /// Constructor for creation
+    LargeLq(Home home, ViewArray<IntView>& x, const IntArgs& a,
+            long long int c);
+  public:
+    /// Create copy during cloning
+    virtual Actor* copy(Space& home, bool share);
+    /// Perform propagation
+    virtual ExecStatus propagate(Space& home, const ModEventDelta& med);
+    /// Post propagator for \f$\sum_{i=0}^{|x|-1}a_i\cdot x_i\leq c\f$
+    static ExecStatus post(Home home, ViewArray<IntView>& x,
+                           const IntArgs& a, long long int c);
+  };
+
+}}}
+
+#include <gecode/int/linear/int-large.hpp>
+
 namespace Gecode { namespace Int { namespace Linear {
 
   /*
@@ -0,0 +1,156 @@
+/* -*- mode: C++; c-basic-offset: 2; indent-tabs-mode: nil -*- */
+/*
+ *  Main authors:
+ *     Christian Schulte <schulte@gecode.org>
+ *
+ *  Copyright:
+ *     Christian Schulte, 2011
+ *
+ *  Last modified:
+ *     $Date$ by $Author$
+ *     $Revision$
+ *
+ *  This file is part of Gecode, the generic constraint
+ *  development environment:
+ *     http://www.gecode.org
+ *
+ *  Permission is hereby granted, free of charge, to any person obtaining
+ *  a copy of this software and associated documentation files (the
+ *  "Software"), to deal in the Software without restriction, including
+ *  without limitation the rights to use, copy, modify, merge, publish,
+ *  distribute, sublicense, and/or sell copies of the Software, and to
+ *  permit persons to whom the Software is furnished to do so, subject to
+ *  the following conditions:
+ *
+ *  The above copyright notice and this permission notice shall be
+ *  included in all copies or substantial portions of the Software.
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ *  EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ *  MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ *  NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE
+ *  LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+ *  OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+ *  WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ */
+
+#include <gecode/int/linear.hh>
+
+namespace Gecode { namespace Int { namespace Linear {
+
+  /*
+   * Linear propagators for many views
+   *
+   */
+  PropCost
+  LargeLin::cost(const Space&, const ModEventDelta&) const {
+    return PropCost::linear(PropCost::LO, x.size());
+  }
+
+  size_t
+  LargeLin::dispose(Space& home) {
+    x.cancel(home,*this,PC_INT_BND);
+    (void) Propagator::dispose(home);
+    return sizeof(*this);
+  }
+
+
+  /*
+   * Bound consistent linear equation for many views
+   *
+   */
+  ExecStatus
+  LargeEq::post(Home home, ViewArray<IntView>& x, const IntArgs& a,
+                long long int c) {
+    (void) new (home) LargeEq(home,x,a,c);
+    return ES_OK;
+  }
+
+  Actor*
+  LargeEq::copy(Space& home, bool share) {
+    return new (home) LargeEq(home,share,*this);
+  }
+
+  ExecStatus
+  LargeEq::propagate(Space& home, const ModEventDelta&) {
+    long long int sl, su;
+    bounds(sl,su);
+
+    if ((sl > c) || (su < c))
+      return ES_FAILED;
+
+    bool mod;
+    do {
+      mod = false;
+      // Propagate upper bounds: each term is at most c-(sl-l[i])
+      long long int s = c - sl;
+      if (width() > s)
+        for (int i = x.size(); i--; )
+          if (u[i] - l[i] > s) {
+            long long int ui = u[i];
+            if (!lq(home,i,l[i]+s))
+              return ES_FAILED;
+            su -= ui - u[i];
+            mod = true;
+          }
+      // Propagate lower bounds: each term is at least c-(su-u[i])
+      long long int t = su - c;
+      if (width() > t)
+        for (int i = x.size(); i--; )
+          if (u[i] - l[i] > t) {
+            long long int li = l[i];
+            if (!gq(home,i,u[i]-t))
+              return ES_FAILED;
+            sl += l[i] - li;
+            mod = true;
+          }
+    } while (mod);
+
+    return (sl == su) ? home.ES_SUBSUMED(*this) : ES_FIX;
+  }
+
+
+  /*
+   * Bound consistent linear inequation for many views
+   *
+   */
+  ExecStatus
+  LargeLq::post(Home home, ViewArray<IntView>& x, const IntArgs& a,
+                long long int c) {
+    (void) new (home) LargeLq(home,x,a,c);
+    return ES_OK;
+  }
+
+  Actor*
+  LargeLq::copy(Space& home, bool share) {
+    return new (home) LargeLq(home,share,*this);
+  }
+
+  ExecStatus
+  LargeLq::propagate(Space& home, const ModEventDelta&) {
+    long long int sl, su;
+    bounds(sl,su);
+
+    if (su <= c)
+      return home.ES_SUBSUMED(*this);
+    if (sl > c)
+      return ES_FAILED;
+
+    // Propagate upper bounds: each term is at most c-(sl-l[i])
+    long long int s = c - sl;
+    if (width() > s)
+      for (int i = x.size(); i--; )
+        if (u[i] - l[i] > s) {
+          long long int ui = u[i];
+          if (!lq(home,i,l[i]+s))
+            return ES_FAILED;
+          su -= ui - u[i];
+        }
+
+    return (su <= c) ? home.ES_SUBSUMED(*this) : ES_FIX;
+  }
+
+}}}
+
+// STATISTICS: int-prop
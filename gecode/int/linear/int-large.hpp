@@ -0,0 +1,184 @@
+/* -*- mode: C++; c-basic-offset: 2; indent-tabs-mode: nil -*- */
+/*
+ *  Main authors:
+ *     Christian Schulte <schulte@gecode.org>
+ *
+ *  Copyright:
+ *     Christian Schulte, 2011
+ *
+ *  Last modified:
+ *     $Date$ by $Author$
+ *     $Revision$
+ *
+ *  This file is part of Gecode, the generic constraint
+ *  development environment:
+ *     http://www.gecode.org
+ *
+ *  Permission is hereby granted, free of charge, to any person obtaining
+ *  a copy of this software and associated documentation files (the
+ *  "Software"), to deal in the Software without restriction, including
+ *  without limitation the rights to use, copy, modify, merge, publish,
+ *  distribute, sublicense, and/or sell copies of the Software, and to
+ *  permit persons to whom the Software is furnished to do so, subject to
+ *  the following conditions:
+ *
+ *  The above copyright notice and this permission notice shall be
+ *  included in all copies or substantial portions of the Software.
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ *  EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ *  MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ *  NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE
+ *  LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+ *  OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+ *  WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ */
+
+namespace Gecode { namespace Int { namespace Linear {
+
+  /*
+   * Linear propagators for many views
+   *
+   */
+  forceinline
+  LargeLin::LargeLin(Home home, ViewArray<IntView>& x0, const IntArgs& a0,
+                     long long int c0)
+    : Propagator(home), x(x0), c(c0) {
+    int n = x.size();
+    a = static_cast<Space&>(home).alloc<int>(n);
+    l = static_cast<Space&>(home).alloc<long long int>(n);
+    u = static_cast<Space&>(home).alloc<long long int>(n);
+    for (int i=n; i--; ) {
+      a[i] = a0[i]; l[i] = u[i] = 0;
+    }
+    x.subscribe(home,*this,PC_INT_BND);
+  }
+
+  forceinline
+  LargeLin::LargeLin(Space& home, bool share, LargeLin& p)
+    : Propagator(home,share,p), c(p.c) {
+    x.update(home,share,p.x);
+    int n = x.size();
+    a = home.alloc<int>(n);
+    l = home.alloc<long long int>(n);
+    u = home.alloc<long long int>(n);
+    for (int i=n; i--; ) {
+      a[i] = p.a[i]; l[i] = p.l[i]; u[i] = p.u[i];
+    }
+  }
+
+  forceinline void
+  LargeLin::bounds(long long int& sl, long long int& su) {
+    int n = x.size();
+    for (int i=n; i--; )
+      if (x[i].assigned()) {
+        c -= static_cast<long long int>(a[i]) * x[i].val();
+        n--;
+        x[i] = x[n]; a[i] = a[n]; l[i] = l[n]; u[i] = u[n];
+      } else if (a[i] > 0) {
+        l[i] = static_cast<long long int>(a[i]) * x[i].min();
+        u[i] = static_cast<long long int>(a[i]) * x[i].max();
+      } else {
+        l[i] = static_cast<long long int>(a[i]) * x[i].max();
+        u[i] = static_cast<long long int>(a[i]) * x[i].min();
+      }
+    x.size(n);
+    // Views that have been moved have already been refreshed
+    sl = 0; su = 0;
+    for (int i=0; i<n; i++) {
+      sl += l[i]; su += u[i];
+    }
+  }
+
+  forceinline long long int
+  LargeLin::width(void) const {
+    long long int w = 0;
+    for (int i=0; i<x.size(); i++)
+      w = std::max(w, u[i]-l[i]);
+    return w;
+  }
+
+  /// Return \f$\lfloor n/d\rfloor\f$ for \f$d>0\f$
+  forceinline long long int
+  floor_div(long long int n, long long int d) {
+    assert(d > 0);
+    long long int q = n / d;
+    return ((n % d) < 0) ? q-1 : q;
+  }
+
+  forceinline bool
+  LargeLin::lq(Space& home, int i, long long int v) {
+    if (a[i] > 0) {
+      long long int m = floor_div(v,a[i]);
+      if (m < x[i].min())
+        return false;
+      if (m < x[i].max()) {
+        (void) x[i].lq(home,static_cast<int>(m));
+        u[i] = static_cast<long long int>(a[i]) * x[i].max();
+      }
+    } else {
+      long long int m = -floor_div(v,-a[i]);
+      if (m > x[i].max())
+        return false;
+      if (m > x[i].min()) {
+        (void) x[i].gq(home,static_cast<int>(m));
+        u[i] = static_cast<long long int>(a[i]) * x[i].min();
+      }
+    }
+    return true;
+  }
+
+  forceinline bool
+  LargeLin::gq(Space& home, int i, long long int v) {
+    if (a[i] > 0) {
+      long long int m = -floor_div(-v,a[i]);
+      if (m > x[i].max())
+        return false;
+      if (m > x[i].min()) {
+        (void) x[i].gq(home,static_cast<int>(m));
+        l[i] = static_cast<long long int>(a[i]) * x[i].min();
+      }
+    } else {
+      long long int m = floor_div(-v,-a[i]);
+      if (m < x[i].min())
+        return false;
+      if (m < x[i].max()) {
+        (void) x[i].lq(home,static_cast<int>(m));
+        l[i] = static_cast<long long int>(a[i]) * x[i].max();
+      }
+    }
+    return true;
+  }
+
+
+  /*
+   * Bound consistent linear equation for many views
+   *
+   */
+  forceinline
+  LargeEq::LargeEq(Home home, ViewArray<IntView>& x, const IntArgs& a,
+                   long long int c)
+    : LargeLin(home,x,a,c) {}
+
+  forceinline
+  LargeEq::LargeEq(Space& home, bool share, LargeEq& p)
+    : LargeLin(home,share,p) {}
+
+
+  /*
+   * Bound consistent linear inequation for many views
+   *
+   */
+  forceinline
+  LargeLq::LargeLq(Home home, ViewArray<IntView>& x, const IntArgs& a,
+                   long long int c)
+    : LargeLin(home,x,a,c) {}
+
+  forceinline
+  LargeLq::LargeLq(Space& home, bool share, LargeLq& p)
+    : LargeLin(home,share,p) {}
+
+}}}
+
+// STATISTICS: int-prop
@@ -36,6 +36,7 @@
  */
 
 #include <cfloat>
+#include <cmath>
 #include <algorithm>
 
 #include <gecode/int/rel.hh>
@@ -127,6 +128,21 @@ namespace Gecode { namespace Int { namespace Linear {
     return is_ip;
   }
 
+  /// Test whether the absolute values of all terms and \a d sum up within limits
+  inline bool
+  bounded(Term<IntView>* t_p, int n_p,
+          Term<IntView>* t_n, int n_n,
+          double d) {
+    double s = std::abs(d);
+    for (int i = n_p; i--; )
+      s += t_p[i].a * std::max(std::abs(static_cast<double>(t_p[i].x.min())),
+                               std::abs(static_cast<double>(t_p[i].x.max())));
+    for (int i = n_n; i--; )
+      s += t_n[i].a * std::max(std::abs(static_cast<double>(t_n[i].x.min())),
+                               std::abs(static_cast<double>(t_n[i].x.max())));
+    return s <= Limits::double_max;
+  }
+
   /**
    * \brief Posting n-ary propagators
    *
@@ -242,7 +258,25 @@ namespace Gecode { namespace Int { namespace Linear {
 
     bool is_ip = precision(t_p,n_p,t_n,n_n,d);
 
-    if (is_unit && is_ip && (icl != ICL_DOM)) {
+    if ((n >= large_n) && (r != IRT_NQ) &&
+        ((icl != ICL_DOM) || (r != IRT_EQ)) &&
+        bounded(t_p,n_p,t_n,n_n,d)) {
+      // Many views with bounds propagation on flat arrays
+      ViewArray<IntView> x(home,n);
+      IntArgs a(n);
+      for (int i = n_p; i--; ) {
+        x[i] = t_p[i].x; a[i] = t_p[i].a;
+      }
+      for (int i = n_n; i--; ) {
+        x[n_p+i] = t_n[i].x; a[n_p+i] = -t_n[i].a;
+      }
+      long long int e = static_cast<long long int>(d);
+      if (r == IRT_EQ) {
+        GECODE_ES_FAIL(LargeEq::post(home,x,a,e));
+      } else {
+        GECODE_ES_FAIL(LargeLq::post(home,x,a,e));
+      }
+    } else if (is_unit && is_ip && (icl != ICL_DOM)) {
       // Unit coefficients with integer precision
       c = static_cast<int>(d);
       if (n == 2) {
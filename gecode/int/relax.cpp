@@ -0,0 +1,94 @@
+/* -*- mode: C++; c-basic-offset: 2; indent-tabs-mode: nil -*- */
+/*
+ *  Main authors:
+ *     Christian Schulte <schulte@gecode.org>
+ *
+ *  Copyright:
+ *     Christian Schulte, 2011
+ *
+ *  Last modified:
+ *     $Date$ by $Author$
+ *     $Revision$
+ *
+ *  This file is part of Gecode, the generic constraint
+ *  development environment:
+ *     http://www.gecode.org
+ *
+ *  Permission is hereby granted, free of charge, to any person obtaining
+ *  a copy of this software and associated documentation files (the
+ *  "Software"), to deal in the Software without restriction, including
+ *  without limitation the rights to use, copy, modify, merge, publish,
+ *  distribute, sublicense, and/or sell copies of the Software, and to
+ *  permit persons to whom the Software is furnished to do so, subject to
+ *  the following conditions:
+ *
+ *  The above copyright notice and this permission notice shall be
+ *  included in all copies or substantial portions of the Software.
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ *  EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ *  MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ *  NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE
+ *  LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+ *  OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+ *  WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ */
+
+
+#include <gecode/int.hh>
+
+namespace Gecode {
+
+  namespace Int { namespace Relax {
+
+    /// Constrain view \a x to value \a n with probability \f$1-p\f$
+    template<class View>
+    forceinline ModEvent
+    relax(Space& home, View x, int n,
+          Support::RandomGenerator& r, unsigned int t) {
+      return (r(static_cast<unsigned int>(Limits::max)) >= t) ?
+        x.eq(home,n) : ME_GEN_NONE;
+    }
+
+    /// Return threshold for probability \a p
+    forceinline unsigned int
+    threshold(double p) {
+      if ((p < 0.0) || (p > 1.0))
+        throw OutOfLimits("Int::relax");
+      return static_cast<unsigned int>(p * Limits::max);
+    }
+
+  }}
+
+  void
+  relax(Home home, const IntVarArgs& x, const IntVarArgs& sx,
+        Support::RandomGenerator& r, double p) {
+    using namespace Int;
+    if (x.size() != sx.size())
+      throw ArgumentSizeMismatch("Int::relax");
+    unsigned int t = Relax::threshold(p);
+    if (home.failed()) return;
+    for (int i=x.size(); i--; ) {
+      IntView xv(x[i]);
+      GECODE_ME_FAIL(Relax::relax(home,xv,sx[i].val(),r,t));
+    }
+  }
+
+  void
+  relax(Home home, const BoolVarArgs& x, const BoolVarArgs& sx,
+        Support::RandomGenerator& r, double p) {
+    using namespace Int;
+    if (x.size() != sx.size())
+      throw ArgumentSizeMismatch("Int::relax");
+    unsigned int t = Relax::threshold(p);
+    if (home.failed()) return;
+    for (int i=x.size(); i--; ) {
+      BoolView xv(x[i]);
+      GECODE_ME_FAIL(Relax::relax(home,xv,sx[i].val(),r,t));
+    }
+  }
+
+}
+
+// STATISTICS: int-post
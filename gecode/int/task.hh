@@ -90,6 +90,10 @@ namespace Gecode { namespace Int {
     void subscribe(Space& home, Propagator& p, PropCond pc);
     /// Cancel subscription of propagator \a p for task
     void cancel(Space& home, Propagator& p, PropCond pc);
+    /// Subscribe advisor \a a to task
+    void subscribe(Space& home, Advisor& a);
+    /// Cancel subscription of advisor \a a for task
+    void cancel(Space& home, Advisor& a);
     //@}
   };
 
@@ -449,6 +453,115 @@ namespace Gecode { namespace Int {
 #include <gecode/int/task/prop.hpp>
 #include <gecode/int/task/purge.hpp>
 
+namespace Gecode { namespace Int {
+
+  /**
+   * \brief Incremental profile of intervals with heights
+   *
+   * The profile maintains for a fixed number of items an interval
+   * \f$[b,e)\f$ with a height \f$h\f$ (typically the compulsory part
+   * of a task and its resource requirement) together with the events
+   * of all intervals sorted by time. Changing the interval of an item
+   * only records the item as modified, the events are updated when the
+   * profile is synchronized: then only the events of modified items are
+   * removed and inserted. Hence, synchronizing \f$k\f$ modified items
+   * of \f$n\f$ items takes \f$O(n+k\log k)\f$ rather than
+   * \f$O(n\log n)\f$ time.
+   *
+   * When the profile is cloned, only the intervals are copied and all
+   * items are recorded as modified: the events are reconstructed by
+   * the first synchronization after cloning.
+   *
+   * Requires \code #include <gecode/int/task.hh> \endcode
+   */
+  class Profile {
+  protected:
+    /// Interval with height of an item
+    class Item {
+    public:
+      /// Begin of interval
+      int b;
+      /// End of interval
+      int e;
+      /// Height
+      int h;
+    };
+    /// Event of the profile
+    class Event {
+    public:
+      /// Time of event
+      int t;
+      /// Item of event
+      int i;
+      /// Order by time
+      bool operator <(const Event& e) const;
+    };
+    /// Number of items
+    int n;
+    /// Intervals of items as reflected by the events
+    Item* cur;
+    /// Intervals of items as set
+    Item* nxt;
+    /// Whether an item has been modified
+    bool* mod;
+    /// Modified items
+    int* m;
+    /// Number of modified items
+    int n_m;
+    /// Events sorted by time
+    Event* ev;
+    /// Number of events
+    int n_ev;
+    /// Allocate memory for \a n0 items
+    void allocate(Space& home, int n0);
+  public:
+    /// \name Constructors and initialization
+    //@{
+    /// Default constructor (no items)
+    Profile(void);
+    /// Initialize for \a n items with empty intervals
+    void init(Space& home, int n);
+    //@}
+
+    /// \name Items
+    //@{
+    /// Return number of items
+    int items(void) const;
+    /// Set interval of item \a i to \f$[b,e)\f$ with height \a h
+    void set(int i, int b, int e, int h);
+    /// Set interval of item \a i to be empty
+    void empty(int i);
+    /// Update events for all modified items
+    void sync(Space& home);
+    //@}
+
+    /// \name Events (only valid after synchronization)
+    //@{
+    /// Return number of events
+    int events(void) const;
+    /// Return time of event \a k
+    int time(int k) const;
+    /// Return item of event \a k
+    int item(int k) const;
+    /// Test whether event \a k is the begin of an interval
+    bool begin(int k) const;
+    /// Return change of height by event \a k
+    int height(int k) const;
+    //@}
+
+    /// \name Cloning and disposal
+    //@{
+    /// Update profile to be a clone of profile \a p
+    void update(Space& home, const Profile& p);
+    /// Release memory
+    void dispose(Space& home);
+    //@}
+  };
+
+}}
+
+#include <gecode/int/task/profile.hpp>
+
 #endif
 
 // STATISTICS: scheduling-prop
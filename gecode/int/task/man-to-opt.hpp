@@ -94,6 +94,18 @@ namespace Gecode { namespace Int {
     _m.cancel(home, p, Int::PC_BOOL_VAL);
     ManTask::cancel(home, p, pc);
   }
+  template<class ManTask>
+  forceinline void
+  ManToOptTask<ManTask>::subscribe(Space& home, Advisor& a) {
+    ManTask::subscribe(home, a);
+    _m.subscribe(home, a);
+  }
+  template<class ManTask>
+  forceinline void
+  ManToOptTask<ManTask>::cancel(Space& home, Advisor& a) {
+    _m.cancel(home, a);
+    ManTask::cancel(home, a);
+  }
 
 }}
 
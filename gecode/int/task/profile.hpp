@@ -0,0 +1,203 @@
+/* -*- mode: C++; c-basic-offset: 2; indent-tabs-mode: nil -*- */
+/*
+ *  Main authors:
+ *     Christian Schulte <schulte@gecode.org>
+ *
+ *  Copyright:
+ *     Christian Schulte, 2011
+ *
+ *  Last modified:
+ *     $Date$ by $Author$
+ *     $Revision$
+ *
+ *  This file is part of Gecode, the generic constraint
+ *  development environment:
+ *     http://www.gecode.org
+ *
+ *  Permission is hereby granted, free of charge, to any person obtaining
+ *  a copy of this software and associated documentation files (the
+ *  "Software"), to deal in the Software without restriction, including
+ *  without limitation the rights to use, copy, modify, merge, publish,
+ *  distribute, sublicense, and/or sell copies of the Software, and to
+ *  permit persons to whom the Software is furnished to do so, subject to
+ *  the following conditions:
+ *
+ *  The above copyright notice and this permission notice shall be
+ *  included in all copies or substantial portions of the Software.
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ *  EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ *  MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ *  NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE
+ *  LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+ *  OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+ *  WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ */
+
+namespace Gecode { namespace Int {
+
+  /*
+   * Events
+   *
+   */
+  forceinline bool
+  Profile::Event::operator <(const Event& e) const {
+    return t < e.t;
+  }
+
+
+  /*
+   * Profile
+   *
+   */
+  forceinline
+  Profile::Profile(void)
+    : n(0), cur(NULL), nxt(NULL), mod(NULL), m(NULL), n_m(0),
+      ev(NULL), n_ev(0) {}
+
+  forceinline void
+  Profile::allocate(Space& home, int n0) {
+    n = n0;
+    cur = home.alloc<Item>(n);
+    nxt = home.alloc<Item>(n);
+    mod = home.alloc<bool>(n);
+    m = home.alloc<int>(n);
+    ev = home.alloc<Event>(2*n);
+    n_ev = 0;
+    for (int i=n; i--; ) {
+      cur[i].b = cur[i].e = cur[i].h = 0;
+    }
+  }
+
+  forceinline void
+  Profile::init(Space& home, int n0) {
+    allocate(home,n0);
+    n_m = 0;
+    for (int i=n; i--; ) {
+      nxt[i].b = nxt[i].e = nxt[i].h = 0;
+      mod[i] = false;
+    }
+  }
+
+  forceinline void
+  Profile::update(Space& home, const Profile& p) {
+    allocate(home,p.n);
+    // Record all items as modified, events are reconstructed by sync
+    n_m = n;
+    for (int i=n; i--; ) {
+      nxt[i] = p.nxt[i]; mod[i] = true; m[i] = i;
+    }
+  }
+
+  forceinline void
+  Profile::dispose(Space& home) {
+    home.free<Item>(cur,n);
+    home.free<Item>(nxt,n);
+    home.free<bool>(mod,n);
+    home.free<int>(m,n);
+    home.free<Event>(ev,2*n);
+  }
+
+  forceinline int
+  Profile::items(void) const {
+    return n;
+  }
+
+  forceinline void
+  Profile::set(int i, int b, int e, int h) {
+    assert((i >= 0) && (i < n));
+    if ((b >= e) || (h == 0)) {
+      b = e = h = 0;
+    }
+    if ((nxt[i].b == b) && (nxt[i].e == e) && (nxt[i].h == h))
+      return;
+    nxt[i].b = b; nxt[i].e = e; nxt[i].h = h;
+    if (!mod[i]) {
+      mod[i] = true; m[n_m++] = i;
+    }
+  }
+
+  forceinline void
+  Profile::empty(int i) {
+    set(i,0,0,0);
+  }
+
+  forceinline void
+  Profile::sync(Space& home) {
+    // Keep only the items that have actually changed
+    int n_c = 0;
+    for (int k=0; k<n_m; k++) {
+      int i = m[k];
+      if ((cur[i].b != nxt[i].b) || (cur[i].e != nxt[i].e) ||
+          (cur[i].h != nxt[i].h))
+        m[n_c++] = i;
+      else
+        mod[i] = false;
+    }
+    n_m = 0;
+    if (n_c == 0)
+      return;
+
+    // Remove events of changed items
+    int n_k = 0;
+    for (int k=0; k<n_ev; k++)
+      if (!mod[ev[k].i])
+        ev[n_k++] = ev[k];
+
+    // Create and sort events for changed items
+    Region r(home);
+    Event* ne = r.alloc<Event>(2*n_c);
+    int n_ne = 0;
+    for (int k=n_c; k--; ) {
+      int i = m[k];
+      cur[i] = nxt[i]; mod[i] = false;
+      if (cur[i].h != 0) {
+        ne[n_ne].t = cur[i].b; ne[n_ne].i = i; n_ne++;
+        ne[n_ne].t = cur[i].e; ne[n_ne].i = i; n_ne++;
+      }
+    }
+    Support::quicksort<Event>(ne,n_ne);
+
+    // Merge from the back
+    int k = n_k-1, l = n_ne-1;
+    n_ev = n_k+n_ne;
+    for (int w = n_ev-1; l >= 0; w--)
+      if ((k >= 0) && (ne[l] < ev[k]))
+        ev[w] = ev[k--];
+      else
+        ev[w] = ne[l--];
+    r.free<Event>(ne,2*n_c);
+  }
+
+  forceinline int
+  Profile::events(void) const {
+    return n_ev;
+  }
+
+  forceinline int
+  Profile::time(int k) const {
+    assert((k >= 0) && (k < n_ev));
+    return ev[k].t;
+  }
+
+  forceinline int
+  Profile::item(int k) const {
+    assert((k >= 0) && (k < n_ev));
+    return ev[k].i;
+  }
+
+  forceinline bool
+  Profile::begin(int k) const {
+    assert((k >= 0) && (k < n_ev));
+    return cur[ev[k].i].b == ev[k].t;
+  }
+
+  forceinline int
+  Profile::height(int k) const {
+    return begin(k) ? cur[ev[k].i].h : -cur[ev[k].i].h;
+  }
+
+}}
+
+// STATISTICS: int-other
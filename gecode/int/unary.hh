@@ -134,6 +134,10 @@ namespace Gecode { namespace Int { namespace Unary {
     void subscribe(Space& home, Propagator& p, PropCond pc=Int::PC_INT_BND);
     /// Cancel subscription of propagator \a p for task
     void cancel(Space& home, Propagator& p, PropCond pc=Int::PC_INT_BND);
+    /// Subscribe advisor \a a to task
+    void subscribe(Space& home, Advisor& a);
+    /// Cancel subscription of advisor \a a for task
+    void cancel(Space& home, Advisor& a);
     //@}
 
   };
@@ -354,6 +358,10 @@ namespace Gecode { namespace Int { namespace Unary {
     void subscribe(Space& home, Propagator& p, PropCond pc=Int::PC_INT_BND);
     /// Cancel subscription of propagator \a p for task
     void cancel(Space& home, Propagator& p, PropCond pc=Int::PC_INT_BND);
+    /// Subscribe advisor \a a to task
+    void subscribe(Space& home, Advisor& a);
+    /// Cancel subscription of advisor \a a for task
+    void cancel(Space& home, Advisor& a);
     //@}
 
   };
@@ -152,6 +152,14 @@ namespace Gecode { namespace Int { namespace Unary {
   ManFixPTask::cancel(Space& home, Propagator& p, PropCond pc) {
     _s.cancel(home, p, pc);
   }
+  forceinline void
+  ManFixPTask::subscribe(Space& home, Advisor& a) {
+    _s.subscribe(home, a);
+  }
+  forceinline void
+  ManFixPTask::cancel(Space& home, Advisor& a) {
+    _s.cancel(home, a);
+  }
 
   template<class Char, class Traits>
   std::basic_ostream<Char,Traits>&
@@ -440,6 +448,18 @@ namespace Gecode { namespace Int { namespace Unary {
     _p.cancel(home, p, pc);
     _e.cancel(home, p, pc);
   }
+  forceinline void
+  ManFlexTask::subscribe(Space& home, Advisor& a) {
+    _s.subscribe(home, a);
+    _p.subscribe(home, a);
+    _e.subscribe(home, a);
+  }
+  forceinline void
+  ManFlexTask::cancel(Space& home, Advisor& a) {
+    _s.cancel(home, a);
+    _p.cancel(home, a);
+    _e.cancel(home, a);
+  }
 
   template<class Char, class Traits>
   std::basic_ostream<Char,Traits>&
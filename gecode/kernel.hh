@@ -124,6 +124,7 @@
 
 #include <gecode/kernel/archive.hpp>
 #include <gecode/kernel/global-prop-info.hpp>
+#include <gecode/kernel/profile.hpp>
 #include <gecode/kernel/core.hpp>
 #include <gecode/kernel/modevent.hpp>
 #include <gecode/kernel/range-list.hpp>
@@ -78,6 +78,8 @@ namespace Gecode {
     EmptyValSelChoice choice(const Space& home, Archive& e);
     /// Commit to choice
     void commit(Space& home, const EmptyValSelChoice& c, unsigned a);
+    /// Return no-good literal for alternative \a a (none by default)
+    NGL* ngl(Space& home, unsigned int a, View x, Val n) const;
     /// Updating during cloning
     void update(Space& home, bool share, ValSelBase& vs);
     /// Delete value selection
@@ -115,6 +117,11 @@ namespace Gecode {
   forceinline void
   ValSelBase<View,Val>::commit(Space&, const EmptyValSelChoice&, unsigned int) {}
   template<class View, class Val>
+  forceinline NGL*
+  ValSelBase<View,Val>::ngl(Space&, unsigned int, View, Val) const {
+    return NULL;
+  }
+  template<class View, class Val>
   forceinline void
   ValSelBase<View,Val>::update(Space&, bool, ValSelBase<View,Val>&) {}
   template<class View, class Val>
@@ -93,11 +93,13 @@ namespace Gecode {
 #endif
 
   Space::Space(void)
-    : sm(new SharedMemory), mm(sm), n_wmp(0) {
+    : sm(new SharedMemory), mm(sm), n_wmp(0), ap(false) {
 #ifdef GECODE_HAS_VAR_DISPOSE
     for (int i=0; i<AllVarConf::idx_d; i++)
       _vars_d[i] = NULL;
 #endif
+    for (int i=0; i<UA_N; i++)
+      ua[i] = NULL;
     // Initialize propagator and brancher links
     pl.init();
     bl.init();
@@ -201,6 +203,11 @@ namespace Gecode {
     if (pc.p.active >= &pc.p.queue[0]) {
       Propagator* p;
       ModEventDelta med_o;
+      ExecStatus es;
+#ifdef GECODE_PROPAGATOR_PROFILE
+      PropagatorProfile::Entry* pe;
+      unsigned long long int t_s, t_w;
+#endif
       goto unstable;
     execute:
       stat.propagate++;
@@ -208,7 +215,50 @@ namespace Gecode {
       med_o = p->u.med;
       // Clear med but leave propagator in queue
       p->u.med = 0;
-      switch (p->propagate(*this,med_o)) {
+#ifdef GECODE_PROPAGATOR_PROFILE
+      // The propagator might be deleted by propagation, collect info now
+      if (p->prof == NULL)
+        p->prof = PropagatorProfile::entry(typeid(*p));
+      pe = p->prof;
+      t_s = PropagatorProfile::now();
+      t_w = (p->t_queue > 0ULL) ? t_s - p->t_queue : 0ULL;
+#endif
+      es = p->propagate(*this,med_o);
+#ifdef GECODE_PROPAGATOR_PROFILE
+      {
+        unsigned long long int t_p = PropagatorProfile::now() - t_s;
+        switch (es) {
+        case ES_FAILED:
+          PropagatorProfile::record(pe,PropagatorProfile::O_FAILED,t_p,t_w);
+          break;
+        case ES_NOFIX:
+          PropagatorProfile::record(pe,PropagatorProfile::O_NOFIX,t_p,t_w);
+          break;
+        case ES_FIX:
+          PropagatorProfile::record(pe,PropagatorProfile::O_FIX,t_p,t_w);
+          break;
+        case __ES_SUBSUMED:
+          PropagatorProfile::record(pe,PropagatorProfile::O_SUBSUMED,t_p,t_w);
+          break;
+        case __ES_PARTIAL:
+          PropagatorProfile::record(pe,PropagatorProfile::O_PARTIAL,t_p,t_w);
+          break;
+        default:
+          GECODE_NEVER;
+        }
+      }
+#endif
+      /*
+       * A propagator that has modified one of its views has been
+       * scheduled again (its modification event delta is not zero).
+       */
+      if (ap) {
+        if (es == ES_FAILED)
+          p->pi.executed(true);
+        else if ((es == ES_FIX) || (es == ES_NOFIX))
+          p->pi.executed(p->u.med != 0);
+      }
+      switch (es) {
       case ES_FAILED:
         // Count failure
         p->pi.fail(gpi);
@@ -346,6 +396,18 @@ namespace Gecode {
     throw SpaceNoBrancher();
   }
 
+  NGL*
+  Space::ngl(const Choice& c, unsigned int a) {
+    if (a >= c.alternatives())
+      throw SpaceIllegalAlternative();
+    if (failed())
+      return NULL;
+    for (Branchers b(*this); b(); ++b)
+      if (b.brancher().id() == c._id)
+        return b.brancher().ngl(*this,c,a);
+    return NULL;
+  }
+
   void
   Space::_commit(const Choice& c, unsigned int a) {
     if (a >= c.alternatives())
@@ -407,11 +469,14 @@ namespace Gecode {
     : sm(s.sm->copy(share)), 
       mm(sm,s.mm,s.pc.p.n_sub*sizeof(Propagator**)),
       gpi(s.gpi),
-      n_wmp(s.n_wmp) {
+      n_wmp(s.n_wmp), ap(s.ap) {
 #ifdef GECODE_HAS_VAR_DISPOSE
     for (int i=0; i<AllVarConf::idx_d; i++)
       _vars_d[i] = NULL;
 #endif
+    // Unique actors register themselves when being copied
+    for (int i=0; i<UA_N; i++)
+      ua[i] = NULL;
     for (int i=0; i<AllVarConf::idx_c; i++)
       pc.c.vars_u[i] = NULL;
     pc.c.vars_noidx = NULL;
@@ -546,6 +611,14 @@ namespace Gecode {
     throw SpaceConstrainUndefined();
   }
 
+  bool
+  Space::slave(const Space&, Support::RandomGenerator&) {
+    return true;
+  }
+
+  void
+  Space::asset(unsigned int) {}
+
   void
   LocalObject::fwdcopy(Space& home, bool share) {
     ActorLink::cast(this)->prev(copy(home,share));
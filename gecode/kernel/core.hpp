@@ -611,6 +611,19 @@ namespace Gecode {
     AP_WEAKLY  = (1 << 1)
   };
 
+  /**
+   * \brief Actors that exist at most once per space
+   *
+   * For each of these actors a space provides a slot such that
+   * constraints can be added to an already existing actor rather
+   * than creating a new actor for each constraint.
+   * \ingroup TaskActor
+   */
+  enum UniqueActor {
+    UA_CLAUSES = 0, ///< Database for Boolean clauses
+    UA_N            ///< Number of unique actors
+  };
+
 
   /**
    * \brief Double-linked list for actors
@@ -763,6 +776,12 @@ namespace Gecode {
     } u;
     /// A reference to global propagator information
     PropInfo& pi;
+#ifdef GECODE_PROPAGATOR_PROFILE
+    /// Profile entry for the propagator's class (NULL if not yet known)
+    PropagatorProfile::Entry* prof;
+    /// Cycle counter when propagator has been scheduled
+    unsigned long long int t_queue;
+#endif
     /// Static cast for a non-null pointer (to give a hint to optimizer)
     static Propagator* cast(ActorLink* al);
     /// Static cast for a non-null pointer (to give a hint to optimizer)
@@ -992,6 +1011,90 @@ namespace Gecode {
     GECODE_KERNEL_EXPORT virtual void archive(Archive& e) const;
   };
 
+  /**
+   * \brief No-good literal recorded during search
+   *
+   * A no-good literal describes the constraint added by committing
+   * to an alternative of a choice (see Brancher::ngl). Literals are
+   * linked into lists, where a literal can be marked as a leaf.
+   *
+   * No-good literals are allocated from the memory of a space.
+   *
+   * \ingroup TaskActor
+   */
+  class GECODE_VTABLE_EXPORT NGL {
+  private:
+    /// Next literal
+    NGL* _next;
+    /// Whether literal is a leaf
+    bool _leaf;
+  public:
+    /// The status of a no-good literal
+    enum Status {
+      FAILED,   ///< The literal is failed
+      SUBSUMED, ///< The literal is subsumed
+      NONE      ///< The literal is neither failed nor subsumed
+    };
+    /// Constructor for creation
+    NGL(void);
+    /// Constructor for cloning \a ngl
+    NGL(Space& home, bool share, NGL& ngl);
+    /// Test the status of the literal
+    virtual NGL::Status status(const Space& home) const = 0;
+    /// Propagate the negation of the literal
+    virtual ExecStatus prune(Space& home) = 0;
+    /// Subscribe propagator \a p to all views of the literal
+    virtual void subscribe(Space& home, Propagator& p) = 0;
+    /// Cancel propagator \a p from all views of the literal
+    virtual void cancel(Space& home, Propagator& p) = 0;
+    /// Create copy
+    virtual NGL* copy(Space& home, bool share) = 0;
+    /// Dispose literal and return its size
+    virtual size_t dispose(Space& home) = 0;
+    /// Return next literal
+    NGL* next(void) const;
+    /// Set next literal to \a n
+    void next(NGL* n);
+    /// Test whether literal is a leaf
+    bool leaf(void) const;
+    /// Mark literal as leaf (\a l is true) or not
+    void leaf(bool l);
+    /// \name Memory management
+    //@{
+    /// Allocate memory from space
+    static void* operator new(size_t s, Space& home);
+    /// Return memory to space
+    static void  operator delete(void* s, Space& home);
+    /// Needed for exceptions
+    static void  operator delete(void* p);
+    //@}
+  };
+
+  /**
+   * \brief No-good literal for a single view
+   *
+   * Propagators are subscribed with propagation condition \a pc.
+   *
+   * \ingroup TaskActor
+   */
+  template<class View, PropCond pc>
+  class ViewNGL : public NGL {
+  protected:
+    /// The view
+    View x;
+  public:
+    /// Constructor for creation
+    ViewNGL(Space& home, View x);
+    /// Constructor for cloning \a ngl
+    ViewNGL(Space& home, bool share, ViewNGL& ngl);
+    /// Subscribe propagator \a p to view
+    virtual void subscribe(Space& home, Propagator& p);
+    /// Cancel propagator \a p from view
+    virtual void cancel(Space& home, Propagator& p);
+    /// Dispose literal and return its size
+    virtual size_t dispose(Space& home);
+  };
+
   /**
    * \brief Base-class for branchers
    *
@@ -1047,6 +1150,14 @@ namespace Gecode {
      */
     virtual ExecStatus commit(Space& home, const Choice& c, 
                               unsigned int a) = 0;
+    /**
+     * \brief Create no-good literal for choice \a c and alternative \a a
+     *
+     * The literal describes what committing to alternative \a a
+     * tells. The default returns NULL: the alternative cannot
+     * be described by a no-good literal.
+     */
+    virtual NGL* ngl(Space& home, const Choice& c, unsigned int a) const;
     /// Return unsigned brancher id
     unsigned int id(void) const;
     //@}
@@ -1288,6 +1399,10 @@ namespace Gecode {
      * it gives the number of weakly monotoning propagators minus one.
      */
     unsigned int n_wmp;
+    /// Whether propagator priorities adapt to measured pruning
+    bool ap;
+    /// Actors that exist at most once per space
+    Actor* ua[UA_N];
 
     /// Used for default argument
     GECODE_KERNEL_EXPORT static StatusStatistics unused_status;
@@ -1392,6 +1507,37 @@ namespace Gecode {
      * \ingroup TaskModelScript
      */
     GECODE_KERNEL_EXPORT virtual void constrain(const Space& best);
+    /**
+     * \brief Slave function for large neighbourhood search
+     *
+     * Must constrain this space (a copy of the root space) to a
+     * neighbourhood of the so far best solution \a best, for example
+     * by fixing a randomly selected subset of the variables to their
+     * values in \a best (see relax()). The random number generator
+     * \a r can be used for selecting the neighbourhood.
+     *
+     * Must return true if the neighbourhood is complete: it contains
+     * all solutions that are better than \a best. If this method is
+     * not redefined, the space is not constrained and true is returned.
+     *
+     * \ingroup TaskModelScript
+     */
+    GECODE_KERNEL_EXPORT virtual bool slave(const Space& best,
+                                            Support::RandomGenerator& r);
+    /**
+     * \brief Asset function for portfolio search
+     *
+     * A portfolio search engine creates its assets as copies of the
+     * root space and then executes this function with the number
+     * \a i of the asset on each copy. Redefining this function allows
+     * to post a different brancher for each asset (branchers are
+     * executed in the order they have been posted, hence the root space
+     * should not already contain branchers). If this method is not
+     * redefined, the space is left unchanged.
+     *
+     * \ingroup TaskModelScript
+     */
+    GECODE_KERNEL_EXPORT virtual void asset(unsigned int i);
     /**
      * \brief Allocate memory from heap for new space
      * \ingroup TaskModelScript
@@ -1524,6 +1670,17 @@ namespace Gecode {
      */
     void commit(const Choice& c, unsigned int a,
                 CommitStatistics& stat=unused_commit);
+    /**
+     * \brief Create no-good literal for choice \a c and alternative \a a
+     *
+     * The literal is created by the brancher that has created the
+     * choice \a c (see Brancher::ngl). Returns NULL if the space has
+     * no such brancher or the alternative cannot be described by
+     * a no-good literal.
+     *
+     * \ingroup TaskSearch
+     */
+    GECODE_KERNEL_EXPORT NGL* ngl(const Choice& c, unsigned int a);
 
     /**
      * \brief Notice actor property
@@ -1541,6 +1698,20 @@ namespace Gecode {
      * \ingroup TaskActor
      */
     void ignore(Actor& a, ActorProperty p);
+    /**
+     * \brief Return unique actor \a u of the space (NULL if none)
+     *
+     * \ingroup TaskActor
+     */
+    Actor* unique(UniqueActor u) const;
+    /**
+     * \brief Register actor \a a as unique actor \a u of the space
+     *
+     * An actor must register itself again when it is copied and must
+     * unregister itself (by registering NULL) when it is disposed.
+     * \ingroup TaskActor
+     */
+    void unique(UniqueActor u, Actor* a);
 
 
     /**
@@ -1666,6 +1837,24 @@ namespace Gecode {
      * branchers.
      */
     GECODE_KERNEL_EXPORT unsigned int branchers(void) const;
+    /**
+     * \brief Set whether propagator priorities adapt to measured pruning
+     *
+     * By default, a propagator is scheduled according to the cost
+     * it reports. With adaptive priorities, a propagator whose
+     * executions frequently modify its views is scheduled with
+     * higher priority, and a propagator whose executions rarely
+     * modify its views with lower priority. The measurements are
+     * shared by all spaces cloned from the same space. The setting
+     * is inherited by clones.
+     * \ingroup TaskActor
+     */
+    void adaptive_priority(bool b);
+    /**
+     * \brief Return whether propagator priorities adapt to measured pruning
+     * \ingroup TaskActor
+     */
+    bool adaptive_priority(void) const;
 
     /// \name Conversion from Space to Home
     //@{
@@ -2461,6 +2650,16 @@ namespace Gecode {
     }
   }
 
+  forceinline Actor*
+  Space::unique(UniqueActor u) const {
+    return ua[u];
+  }
+
+  forceinline void
+  Space::unique(UniqueActor u, Actor* a) {
+    ua[u] = a;
+  }
+
   forceinline Space*
   Space::clone(bool share, CloneStatistics&) const {
     // Clone is only const for search engines. During cloning, several data
@@ -2531,6 +2730,9 @@ namespace Gecode {
          // New propagator information
          static_cast<Space&>(home).gpi.allocate()) {
     u.advisors = NULL;
+#ifdef GECODE_PROPAGATOR_PROFILE
+    prof = NULL; t_queue = 0ULL;
+#endif
     assert((u.med == 0) && (u.size == 0));
     static_cast<Space&>(home).pl.head(this);
   }
@@ -2539,6 +2741,9 @@ namespace Gecode {
   Propagator::Propagator(Space&, bool, Propagator& p) 
     : pi(p.pi) {
     u.advisors = NULL;
+#ifdef GECODE_PROPAGATOR_PROFILE
+    prof = p.prof; t_queue = 0ULL;
+#endif
     assert((u.med == 0) && (u.size == 0));
     // Set forwarding pointer
     p.prev(this);
@@ -2628,6 +2833,80 @@ namespace Gecode {
     return _id;
   }
 
+  forceinline NGL*
+  Brancher::ngl(Space&, const Choice&, unsigned int) const {
+    return NULL;
+  }
+
+
+  /*
+   * No-good literals
+   *
+   */
+  forceinline
+  NGL::NGL(void)
+    : _next(NULL), _leaf(false) {}
+
+  forceinline
+  NGL::NGL(Space&, bool, NGL&)
+    : _next(NULL), _leaf(false) {}
+
+  forceinline NGL*
+  NGL::next(void) const {
+    return _next;
+  }
+  forceinline void
+  NGL::next(NGL* n) {
+    _next = n;
+  }
+  forceinline bool
+  NGL::leaf(void) const {
+    return _leaf;
+  }
+  forceinline void
+  NGL::leaf(bool l) {
+    _leaf = l;
+  }
+
+  forceinline void*
+  NGL::operator new(size_t s, Space& home) {
+    return home.ralloc(s);
+  }
+  forceinline void
+  NGL::operator delete(void*) {}
+  forceinline void
+  NGL::operator delete(void*, Space&) {}
+
+  template<class View, PropCond pc>
+  forceinline
+  ViewNGL<View,pc>::ViewNGL(Space&, View x0)
+    : x(x0) {}
+
+  template<class View, PropCond pc>
+  forceinline
+  ViewNGL<View,pc>::ViewNGL(Space& home, bool share, ViewNGL<View,pc>& ngl)
+    : NGL(home,share,ngl) {
+    x.update(home,share,ngl.x);
+  }
+
+  template<class View, PropCond pc>
+  void
+  ViewNGL<View,pc>::subscribe(Space& home, Propagator& p) {
+    x.subscribe(home,p,pc);
+  }
+
+  template<class View, PropCond pc>
+  void
+  ViewNGL<View,pc>::cancel(Space& home, Propagator& p) {
+    x.cancel(home,p,pc);
+  }
+
+  template<class View, PropCond pc>
+  size_t
+  ViewNGL<View,pc>::dispose(Space&) {
+    return sizeof(*this);
+  }
+
   /*
    * Local objects
    *
@@ -2905,10 +3184,16 @@ namespace Gecode {
   forceinline void
   Space::enqueue(Propagator* p) {
     ActorLink::cast(p)->unlink();
-    ActorLink* c = &pc.p.queue[p->cost(*this,p->u.med).ac];
+    unsigned int ac = p->cost(*this,p->u.med).ac;
+    if (ap)
+      ac = p->pi.priority(ac,PropCost::AC_MAX);
+    ActorLink* c = &pc.p.queue[ac];
     c->tail(ActorLink::cast(p));
     if (c > pc.p.active)
       pc.p.active = c;
+#ifdef GECODE_PROPAGATOR_PROFILE
+    p->t_queue = PropagatorProfile::now();
+#endif
   }
 
   forceinline void
@@ -2940,6 +3225,15 @@ namespace Gecode {
             (pc.p.active > &pc.p.queue[PropCost::AC_MAX+1]));
   }
 
+  forceinline void
+  Space::adaptive_priority(bool b) {
+    ap = b;
+  }
+  forceinline bool
+  Space::adaptive_priority(void) const {
+    return ap;
+  }
+
 
 
   /*
@@ -42,9 +42,17 @@ namespace Gecode {
   /// Class for propagator information
   class PropInfo {
   private:
-    /// Accumulated failure count
-    double _afc;
+    /// Accumulated failure count (updated atomically)
+    volatile unsigned long int _afc;
+    /// Number of recorded executions (not synchronized, approximate)
+    unsigned long int _exec;
+    /// Number of recorded executions that modified a view
+    unsigned long int _prune;
   public:
+    /// Number of executions before priorities are adapted
+    static const unsigned long int exec_min = 32;
+    /// Number of executions after which counts are halved
+    static const unsigned long int exec_max = 1024;
     /// Initialize
     PropInfo(void);
     /// Initialize
@@ -53,9 +61,27 @@ namespace Gecode {
     double afc(void) const;
     /// Increment failure count
     void fail(GlobalPropInfo& gpi);
+    /// Record an execution that has modified a view if \a pruned
+    void executed(bool pruned);
+    /**
+     * \brief Return priority adapted from priority \a ac
+     *
+     * The priority is increased if at least half of the recent
+     * executions modified a view, it is decreased if at most one
+     * eighth did. The result is between 0 and \a ac_max.
+     */
+    unsigned int priority(unsigned int ac, unsigned int ac_max) const;
   };
 
-  /// Globally shared object for propagator information
+  /**
+   * \brief Globally shared object for propagator information
+   *
+   * The information is shared among all spaces that are cloned from
+   * the same space, possibly by different threads. All shared data
+   * (use counts and failure counts) is updated by atomic operations,
+   * the blocks for propagator information are only modified by the
+   * space owning the current object.
+   */
   class GlobalPropInfo {
     friend class PropInfo;
   private:
@@ -76,12 +102,10 @@ namespace Gecode {
     /// The actual object to store the required information
     class Object {
     public:
-      /// Mutex to synchronize globally shared access
-      Support::Mutex* mutex;
       /// Link to previous object (NULL if none)
       Object* parent;
-      /// How many spaces or objects use this object
-      unsigned int use_cnt;
+      /// How many spaces or objects use this object (updated atomically)
+      volatile unsigned long int use_cnt;
       /// Size of current block
       unsigned int size;
       /// Number of free entries in current block
@@ -89,7 +113,7 @@ namespace Gecode {
       /// Currently used block
       Block* cur;
       /// Constructor
-      Object(Support::Mutex* m, Object* p=NULL);
+      Object(Object* p=NULL);
       /// Allocate memory from heap
       static void* operator new(size_t s);
       /// Free memory allocated from heap
@@ -123,14 +147,37 @@ namespace Gecode {
    */
   forceinline
   PropInfo::PropInfo(void)
-    : _afc(0.0) {}
+    : _afc(0UL), _exec(0UL), _prune(0UL) {}
   forceinline void
   PropInfo::init(void) {
-    _afc=0.0;
+    _afc=0UL; _exec=0UL; _prune=0UL;
+  }
+  forceinline void
+  PropInfo::executed(bool pruned) {
+    /*
+     * The counts are shared between threads but are not synchronized:
+     * they only serve as a heuristic and lost updates are harmless.
+     */
+    if (++_exec > exec_max) {
+      _exec >>= 1; _prune >>= 1;
+    }
+    if (pruned)
+      _prune++;
+  }
+  forceinline unsigned int
+  PropInfo::priority(unsigned int ac, unsigned int ac_max) const {
+    unsigned long int e = _exec, p = _prune;
+    if (e < exec_min)
+      return ac;
+    if (2*p >= e)
+      return (ac < ac_max) ? ac+1 : ac_max;
+    if (8*p <= e)
+      return (ac > 0) ? ac-1 : 0;
+    return ac;
   }
   forceinline double
   PropInfo::afc(void) const {
-    return _afc;
+    return static_cast<double>(_afc);
   }
 
 
@@ -158,8 +205,8 @@ namespace Gecode {
   }
 
   forceinline
-  GlobalPropInfo::Object::Object(Support::Mutex* m, Object* p)
-    : mutex(m), parent(p), use_cnt(1), size(size_min), free(size_min),
+  GlobalPropInfo::Object::Object(Object* p)
+    : parent(p), use_cnt(1UL), size(size_min), free(size_min),
       cur(Block::allocate(size)) {}
 
   forceinline GlobalPropInfo::Object*
@@ -183,24 +230,23 @@ namespace Gecode {
   forceinline
   GlobalPropInfo::GlobalPropInfo(void) {
     // No synchronization needed as single thread is creating this object
-    local(new Object(new Support::Mutex));
+    local(new Object);
   }
 
   forceinline
   GlobalPropInfo::GlobalPropInfo(const GlobalPropInfo& gpi) {
     global(gpi.mo);
-    Object* o = object();
-    o->mutex->acquire();
-    o->use_cnt++;
-    o->mutex->release();
+    (void) Support::Atomic::inc(object()->use_cnt);
   }
 
   forceinline
   GlobalPropInfo::~GlobalPropInfo(void) {
-    Support::Mutex* m = object()->mutex;
-    m->acquire();
+    /*
+     * Only the thread that drops the last use of an object deletes
+     * it, hence no further synchronization is required.
+     */
     Object* c = object();
-    while ((c != NULL) && (--c->use_cnt == 0)) {
+    while ((c != NULL) && (Support::Atomic::dec(c->use_cnt) == 0UL)) {
       // Delete all blocks for c
       Block* b = c->cur;
       while (b != NULL) {
@@ -211,18 +257,11 @@ namespace Gecode {
       Object* d = c; c = c->parent;
       delete d; 
     }
-    m->release();
-    // All objects are deleted, so also delete mutex
-    if (c == NULL)
-      delete m;
   }
 
   forceinline void
-  PropInfo::fail(GlobalPropInfo& gpi) {
-    Support::Mutex& m = *gpi.object()->mutex;
-    m.acquire();
-    _afc++;
-    m.release();
+  PropInfo::fail(GlobalPropInfo&) {
+    (void) Support::Atomic::inc(_afc);
   }
 
   forceinline PropInfo&
@@ -234,7 +273,7 @@ namespace Gecode {
      * to the marked pointer AND the local object.
      */
     if (!local())
-      local(new Object(object()->mutex,object()));
+      local(new Object(object()));
 
     assert(local());
 
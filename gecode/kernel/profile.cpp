@@ -0,0 +1,123 @@
+/* -*- mode: C++; c-basic-offset: 2; indent-tabs-mode: nil -*- */
+/*
+ *  Main authors:
+ *     Christian Schulte <schulte@gecode.org>
+ *
+ *  Copyright:
+ *     Christian Schulte, 2011
+ *
+ *  Last modified:
+ *     $Date$ by $Author$
+ *     $Revision$
+ *
+ *  This file is part of Gecode, the generic constraint
+ *  development environment:
+ *     http://www.gecode.org
+ *
+ *  Permission is hereby granted, free of charge, to any person obtaining
+ *  a copy of this software and associated documentation files (the
+ *  "Software"), to deal in the Software without restriction, including
+ *  without limitation the rights to use, copy, modify, merge, publish,
+ *  distribute, sublicense, and/or sell copies of the Software, and to
+ *  permit persons to whom the Software is furnished to do so, subject to
+ *  the following conditions:
+ *
+ *  The above copyright notice and this permission notice shall be
+ *  included in all copies or substantial portions of the Software.
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ *  EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ *  MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ *  NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE
+ *  LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+ *  OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+ *  WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ */
+
+#include <gecode/kernel.hh>
+
+#ifdef GECODE_PROPAGATOR_PROFILE
+
+#ifdef __GNUC__
+#include <cxxabi.h>
+#endif
+
+namespace Gecode {
+
+  Support::Mutex PropagatorProfile::m;
+  PropagatorProfile::Entry* PropagatorProfile::entries = NULL;
+
+  PropagatorProfile::Entry*
+  PropagatorProfile::entry(const std::type_info& ti) {
+    Support::Lock l(m);
+    for (Entry* e = entries; e != NULL; e = e->next)
+      if ((e->name == ti.name()) || !strcmp(e->name,ti.name()))
+        return e;
+    Entry* e = static_cast<Entry*>(heap.ralloc(sizeof(Entry)));
+    e->name = ti.name();
+    e->propagate = e->fix = e->nofix = e->partial = 
+      e->subsumed = e->failed = 0UL;
+    e->cycles = e->wait = 0ULL;
+    e->next = entries; entries = e;
+    return e;
+  }
+
+  void
+  PropagatorProfile::record(Entry* e, Outcome o,
+                            unsigned long long int c,
+                            unsigned long long int w) {
+    Support::Lock l(m);
+    e->propagate++;
+    switch (o) {
+    case O_FIX:      e->fix++; break;
+    case O_NOFIX:    e->nofix++; break;
+    case O_PARTIAL:  e->partial++; break;
+    case O_SUBSUMED: e->subsumed++; break;
+    case O_FAILED:   e->failed++; break;
+    default: GECODE_NEVER;
+    }
+    e->cycles += c;
+    e->wait += w;
+  }
+
+  void
+  PropagatorProfile::print(std::ostream& os) {
+    Support::Lock l(m);
+    os << "propagator,propagate,fix,nofix,partial,subsumed,failed,"
+       << "cycles,wait" << std::endl;
+    for (Entry* e = entries; e != NULL; e = e->next) {
+      const char* n = e->name;
+#ifdef __GNUC__
+      int s;
+      char* dn = abi::__cxa_demangle(n, NULL, NULL, &s);
+      if (s == 0)
+        n = dn;
+#endif
+      // Names might contain commas (template arguments)
+      os << '"' << n << '"';
+#ifdef __GNUC__
+      free(dn);
+#endif
+      os << ',' << e->propagate << ',' << e->fix << ',' << e->nofix
+         << ',' << e->partial << ',' << e->subsumed << ',' << e->failed
+         << ',' << e->cycles << ',' << e->wait << std::endl;
+    }
+  }
+
+  void
+  PropagatorProfile::reset(void) {
+    Support::Lock l(m);
+    // Entries are kept as propagators cache references to them
+    for (Entry* e = entries; e != NULL; e = e->next) {
+      e->propagate = e->fix = e->nofix = e->partial = 
+        e->subsumed = e->failed = 0UL;
+      e->cycles = e->wait = 0ULL;
+    }
+  }
+
+}
+
+#endif
+
+// STATISTICS: kernel-prop
@@ -0,0 +1,141 @@
+/* -*- mode: C++; c-basic-offset: 2; indent-tabs-mode: nil -*- */
+/*
+ *  Main authors:
+ *     Christian Schulte <schulte@gecode.org>
+ *
+ *  Copyright:
+ *     Christian Schulte, 2011
+ *
+ *  Last modified:
+ *     $Date$ by $Author$
+ *     $Revision$
+ *
+ *  This file is part of Gecode, the generic constraint
+ *  development environment:
+ *     http://www.gecode.org
+ *
+ *  Permission is hereby granted, free of charge, to any person obtaining
+ *  a copy of this software and associated documentation files (the
+ *  "Software"), to deal in the Software without restriction, including
+ *  without limitation the rights to use, copy, modify, merge, publish,
+ *  distribute, sublicense, and/or sell copies of the Software, and to
+ *  permit persons to whom the Software is furnished to do so, subject to
+ *  the following conditions:
+ *
+ *  The above copyright notice and this permission notice shall be
+ *  included in all copies or substantial portions of the Software.
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ *  EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ *  MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ *  NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE
+ *  LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+ *  OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+ *  WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ */
+
+#ifdef GECODE_PROPAGATOR_PROFILE
+
+#include <typeinfo>
+#include <iostream>
+#include <ctime>
+
+#if defined(_MSC_VER)
+#include <intrin.h>
+#endif
+
+namespace Gecode {
+
+  /**
+   * \brief Execution profile of propagators
+   *
+   * The profile is only available if %Gecode has been configured
+   * with \c --enable-propagator-profile. It records for each propagator
+   * class how often the propagator has been executed, the outcome
+   * of each execution, the number of cycles spent in propagation,
+   * and the number of cycles the propagator waited in the queue
+   * since it was last scheduled.
+   *
+   * The profile is shared by all spaces (and hence threads) of a
+   * process: it is meant for diagnosis rather than for production.
+   *
+   * \ingroup TaskActor
+   */
+  class PropagatorProfile {
+  public:
+    /// Execution profile for a single propagator class
+    class Entry {
+    public:
+      /// Name of propagator class (as returned by \c typeid)
+      const char* name;
+      /// Next entry
+      Entry* next;
+      /// Number of executions
+      unsigned long int propagate;
+      /// Number of executions reporting a fixpoint
+      unsigned long int fix;
+      /// Number of executions reporting no fixpoint
+      unsigned long int nofix;
+      /// Number of executions that consumed some events only
+      unsigned long int partial;
+      /// Number of executions reporting subsumption
+      unsigned long int subsumed;
+      /// Number of executions reporting failure
+      unsigned long int failed;
+      /// Cycles spent in propagation
+      unsigned long long int cycles;
+      /// Cycles spent waiting in the queue
+      unsigned long long int wait;
+    };
+    /// Outcome of an execution
+    enum Outcome {
+      O_FIX,      ///< Fixpoint
+      O_NOFIX,    ///< No fixpoint
+      O_PARTIAL,  ///< Some events consumed
+      O_SUBSUMED, ///< Subsumed
+      O_FAILED    ///< Failed
+    };
+  private:
+    /// Mutex protecting the entries
+    GECODE_KERNEL_EXPORT static Support::Mutex m;
+    /// List of entries
+    GECODE_KERNEL_EXPORT static Entry* entries;
+  public:
+    /// Return current value of cycle counter
+    static unsigned long long int now(void);
+    /// Return entry for propagator class \a ti
+    GECODE_KERNEL_EXPORT static Entry* entry(const std::type_info& ti);
+    /// Record execution for \a e with outcome \a o, cycles \a c and \a w
+    GECODE_KERNEL_EXPORT 
+    static void record(Entry* e, Outcome o,
+                       unsigned long long int c, unsigned long long int w);
+    /**
+     * \brief Print profile to \a os
+     *
+     * The profile is printed as comma-separated values, one line for
+     * each propagator class, preceded by a line with the column names.
+     */
+    GECODE_KERNEL_EXPORT static void print(std::ostream& os);
+    /// Reset profile
+    GECODE_KERNEL_EXPORT static void reset(void);
+  };
+
+  forceinline unsigned long long int
+  PropagatorProfile::now(void) {
+#if defined(__GNUC__) && (defined(__i386__) || defined(__x86_64__))
+    unsigned int lo, hi;
+    __asm__ __volatile__ ("rdtsc" : "=a" (lo), "=d" (hi));
+    return (static_cast<unsigned long long int>(hi) << 32) | lo;
+#elif defined(_MSC_VER)
+    return static_cast<unsigned long long int>(__rdtsc());
+#else
+    return static_cast<unsigned long long int>(clock());
+#endif
+  }
+
+}
+
+#endif
+
+// STATISTICS: kernel-prop
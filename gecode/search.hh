@@ -77,6 +77,32 @@ namespace Gecode {
   /// %Search engines
   namespace Search {
 
+    /**
+     * \brief Placement of the threads used by parallel search engines
+     *
+     * Binding threads to processing units also keeps the memory they
+     * allocate (spaces and their heap chunks) local to the NUMA node
+     * the thread runs on, provided the operating system allocates
+     * memory on first touch.
+     *
+     * \ingroup TaskModelSearch
+     */
+    enum Affinity {
+      AFF_NONE, ///< Leave placement of threads to the operating system
+      AFF_CORE, ///< Bind each thread to a single processing unit
+      AFF_NODE  ///< Bind each thread to the processing units of a NUMA node
+    };
+
+    /**
+     * \brief How search engines restore spaces when backtracking
+     *
+     * \ingroup TaskModelSearch
+     */
+    enum Restore {
+      RS_COPY,      ///< Copying and recomputation (controlled by \a c_d and \a a_d)
+      RS_RECOMPUTE  ///< Recomputation from the root only (no copies)
+    };
+
     /**
      * \brief %Search configuration
      *
@@ -91,11 +117,27 @@ namespace Gecode {
       const unsigned int c_d = 8;
       /// Create a clone during recomputation if distance is greater than \a a_d (adaptive distance)
       const unsigned int a_d = 2;
+      /// Placement of search threads
+      const Affinity affinity = AFF_NONE;
+      /// How spaces are restored during backtracking
+      const Restore restore = RS_COPY;
+      /// Maximal number of discrepancies for limited discrepancy search
+      const unsigned int d_l = 5;
+      /// Maximal depth of the path for which nogoods are recorded
+      const unsigned int nogoods_limit = 128;
+      /// Maximal depth of failures from which nogoods are learned
+      const unsigned int learn = 0;
+      /// Maximal number of failures for each neighbourhood in LNS
+      const unsigned int f_l = 100;
+      /// Number of assets for portfolio search (zero: one per thread)
+      const unsigned int assets = 0;
 
       /// Minimal number of open nodes for stealing
       const unsigned int steal_limit = 3;
       /// Initial delay in milliseconds for all but first worker thread
       const unsigned int initial_delay = 5;
+      /// Maximal delay in milliseconds after unsuccessful stealing
+      const unsigned int steal_backoff = 4;
     }
 
     /**
@@ -112,6 +154,10 @@ namespace Gecode {
       unsigned long int depth;
       /// Peak memory allocated
       size_t memory;
+      /// Number of restarts
+      unsigned long int restart;
+      /// Number of nogoods posted
+      unsigned long int nogood;
       /// Initialize
       Statistics(void);
       /// Reset
@@ -123,6 +169,7 @@ namespace Gecode {
     };
 
     class Stop;
+    class Cutoff;
 
     /**
      * \brief %Search engine options
@@ -146,6 +193,16 @@ namespace Gecode {
      * Full copying corresponds to a maximal recomputation distance
      * \a c_d of 1.
      *
+     * The option \a restore selects how spaces are restored when
+     * backtracking. With \a RS_COPY, copies are created according to
+     * \a c_d and \a a_d. With \a RS_RECOMPUTE, the only copy kept is
+     * the one for the root of the subtree still to be explored, and
+     * every node is recomputed by replaying the choices (the trail)
+     * from that copy. This minimizes the number and cost of copies for
+     * spaces with a large state that is mostly stable during search,
+     * at the expense of more recomputation. Parallel engines still
+     * create copies when work is stolen.
+     *
      * All recomputation performed is based on batch recomputation: batch
      * recomputation performs propagation only once for an entire path
      * used in recomputation.
@@ -158,6 +215,42 @@ namespace Gecode {
      * is zero, \f$m\f$ threads are chosen. If \f$0<n<1\f$,
      * \f$n \times m\f$ threads are chosen. If \f$-1 <n<0\f$, 
      * \f$(1+n)\times m\f$ threads are chosen.
+     *
+     * The option \a affinity defines whether and how the threads of
+     * a parallel search engine are bound to processing units. When
+     * threads are bound, workers prefer to steal work from workers
+     * running on the same NUMA node.
+     *
+     * The option \a d_l defines the maximal number of discrepancies
+     * explored by limited discrepancy search.
+     *
+     * The option \a cutoff defines when the sequential restart engine
+     * restarts regardless of whether a better solution has been found:
+     * the sequence of cutoff values defines the number of failures
+     * allowed between two restarts. At each restart, nogoods for the
+     * parts of the search tree explored so far are posted
+     * for a path of depth at most \a nogoods_limit (a value of zero
+     * disables nogoods).
+     *
+     * The option \a learn defines up to which depth the sequential
+     * depth-first and restart engines learn from failures (a value of
+     * zero disables learning). For a failed node, the engine computes
+     * a subset of the decisions on the path that already fails by
+     * propagation from the root. The subset is posted as a nogood and
+     * search backjumps to the deepest decision in the subset. As the
+     * subset is computed by propagating from the root for each
+     * decision on the path, learning pays off only if failures have
+     * short explanations. Note that for branchings with a single
+     * alternative (such as assign), learning might find solutions
+     * that search without learning does not find.
+     *
+     * The option \a f_l defines how many failures large neighbourhood
+     * search explores in each neighbourhood before it continues with
+     * the next neighbourhood.
+     *
+     * The option \a assets defines how many assets a portfolio search
+     * engine runs in parallel. If \a assets is zero, the number of
+     * assets is the number of threads as defined by \a threads.
      * 
      * \ingroup TaskModelSearch
      */
@@ -171,13 +264,29 @@ namespace Gecode {
       unsigned int c_d;
       /// Create a clone during recomputation if distance is greater than \a a_d (adaptive distance)
       unsigned int a_d;
+      /// Placement of search threads
+      Affinity affinity;
+      /// How spaces are restored during backtracking
+      Restore restore;
+      /// Maximal number of discrepancies for limited discrepancy search
+      unsigned int d_l;
+      /// Cutoff sequence for restarts (NULL if none)
+      Cutoff* cutoff;
+      /// Maximal depth of the path for which nogoods are recorded
+      unsigned int nogoods_limit;
+      /// Maximal depth of failures from which nogoods are learned
+      unsigned int learn;
+      /// Maximal number of failures for each neighbourhood in LNS
+      unsigned int f_l;
+      /// Number of assets for portfolio search (zero: one per thread)
+      unsigned int assets;
       /// Stop object for stopping search
       Stop* stop;
       /// Default options
       GECODE_SEARCH_EXPORT static const Options def;
       /// Initialize with default values
       Options(void);
-      /// Expand with real number of threads
+      /// Expand with real number of threads and restoration mode
       GECODE_SEARCH_EXPORT Options
       expand(void) const;
     };
@@ -295,6 +404,114 @@ namespace Gecode {
       virtual bool stop(const Statistics& s, const Options& o);
     };
 
+    /**
+     * \defgroup TaskModelSearchCutoff Cutoff sequences for restarts
+     * \ingroup TaskModelSearch
+     *
+     * A cutoff sequence defines how many failures the restart
+     * engine (see Search::Options) explores before it restarts.
+     */
+
+    /**
+     * \brief Base-class for cutoff sequences
+     * \ingroup TaskModelSearchCutoff
+     */
+    class GECODE_SEARCH_EXPORT Cutoff {
+    public:
+      /// Default constructor
+      Cutoff(void);
+      /// Return the current cutoff value
+      virtual unsigned long int operator ()(void) const = 0;
+      /// Increment and return the next cutoff value
+      virtual unsigned long int operator ++(void) = 0;
+      /// Destructor
+      virtual ~Cutoff(void);
+      /// Create constant sequence \f$s,s,s,\ldots\f$
+      static Cutoff* constant(unsigned long int scale=1UL);
+      /// Create linear sequence \f$s,2s,3s,\ldots\f$
+      static Cutoff* linear(unsigned long int scale=1UL);
+      /// Create Luby sequence \f$s,s,2s,s,s,2s,4s,\ldots\f$
+      static Cutoff* luby(unsigned long int scale=1UL);
+      /// Create geometric sequence \f$s,sb,sb^2,\ldots\f$
+      static Cutoff* geometric(unsigned long int scale=1UL, double base=1.5);
+    };
+
+    /**
+     * \brief Cutoff sequence with constant values
+     * \ingroup TaskModelSearchCutoff
+     */
+    class GECODE_SEARCH_EXPORT CutoffConstant : public Cutoff {
+    protected:
+      /// Constant
+      unsigned long int c;
+    public:
+      /// Initialize with constant \a c
+      CutoffConstant(unsigned long int c);
+      /// Return the current cutoff value
+      virtual unsigned long int operator ()(void) const;
+      /// Increment and return the next cutoff value
+      virtual unsigned long int operator ++(void);
+    };
+
+    /**
+     * \brief Cutoff sequence with linearly increasing values
+     * \ingroup TaskModelSearchCutoff
+     */
+    class GECODE_SEARCH_EXPORT CutoffLinear : public Cutoff {
+    protected:
+      /// Scale factor
+      unsigned long int s;
+      /// Current value
+      unsigned long int n;
+    public:
+      /// Initialize with scale factor \a s
+      CutoffLinear(unsigned long int s);
+      /// Return the current cutoff value
+      virtual unsigned long int operator ()(void) const;
+      /// Increment and return the next cutoff value
+      virtual unsigned long int operator ++(void);
+    };
+
+    /**
+     * \brief Cutoff sequence according to Luby, Sinclair, and Zuckerman
+     * \ingroup TaskModelSearchCutoff
+     */
+    class GECODE_SEARCH_EXPORT CutoffLuby : public Cutoff {
+    protected:
+      /// Scale factor
+      unsigned long int s;
+      /// Current position in sequence (starting from one)
+      unsigned long int i;
+      /// Return \a i-th element of the Luby sequence
+      static unsigned long int luby(unsigned long int i);
+    public:
+      /// Initialize with scale factor \a s
+      CutoffLuby(unsigned long int s);
+      /// Return the current cutoff value
+      virtual unsigned long int operator ()(void) const;
+      /// Increment and return the next cutoff value
+      virtual unsigned long int operator ++(void);
+    };
+
+    /**
+     * \brief Cutoff sequence with geometrically increasing values
+     * \ingroup TaskModelSearchCutoff
+     */
+    class GECODE_SEARCH_EXPORT CutoffGeometric : public Cutoff {
+    protected:
+      /// Current value
+      double n;
+      /// Base
+      double b;
+    public:
+      /// Initialize with scale factor \a s and base \a b
+      CutoffGeometric(unsigned long int s, double b);
+      /// Return the current cutoff value
+      virtual unsigned long int operator ()(void) const;
+      /// Increment and return the next cutoff value
+      virtual unsigned long int operator ++(void);
+    };
+
 
     /**
      * \brief %Search engine interface
@@ -307,6 +524,14 @@ namespace Gecode {
       virtual Search::Statistics statistics(void) const = 0;
       /// Check whether engine has been stopped
       virtual bool stopped(void) const = 0;
+      /**
+       * \brief Constrain future solutions to be better than \a b
+       *
+       * Used by portfolio search for sharing solutions among best
+       * solution search engines. Engines that do not search for best
+       * solutions ignore \a b.
+       */
+      virtual void constrain(const Space& b) { (void) b; }
       /// Destructor
       virtual ~Engine(void) {}
     };
@@ -323,6 +548,7 @@ namespace Gecode {
 
 #include <gecode/search/statistics.hpp>
 #include <gecode/search/stop.hpp>
+#include <gecode/search/cutoff.hpp>
 #include <gecode/search/options.hpp>
 
 namespace Gecode {
@@ -413,6 +639,12 @@ namespace Gecode {
    * to the space \a c currently being explored, the engine
    * executes \c c.constrain(t) where \a t is the so-far
    * best solution.
+   *
+   * If a cutoff sequence is given by the search options, the
+   * sequential engine also restarts when the number of failures since
+   * the last restart exceeds the current cutoff value. Nogoods
+   * recorded at restarts prevent that search explores the same parts
+   * of the search tree again.
    * \ingroup TaskModelSearch
    */
   template<class T>
@@ -447,11 +679,153 @@ namespace Gecode {
   template<class T>
   T* restart(T* s, const Search::Options& o=Search::Options::def);
 
+
+
+  /**
+   * \brief Limited discrepancy search engine
+   *
+   * The engine explores the search tree in iterations. Iteration \f$k\f$
+   * returns all solutions that can be reached by taking exactly \f$k\f$
+   * discrepancies, where taking alternative \f$a\f$ of a choice counts
+   * as \f$a\f$ discrepancies. The engine stops after the iteration
+   * for the discrepancy limit \a d_l (see Search::Options) or when the
+   * entire search tree has been explored.
+   *
+   * The parallel version distributes the iterations among the threads:
+   * thread \f$i\f$ out of \f$n\f$ threads runs the iterations
+   * \f$i, i+n, i+2n, \ldots\f$
+   * \ingroup TaskModelSearch
+   */
+  template<class T>
+  class LDS {
+  private:
+    /// The actual search engine
+    Search::Engine* e;
+  public:
+    /// Initialize search engine for space \a s with options \a o
+    LDS(T* s, const Search::Options& o=Search::Options::def);
+    /// Return next solution (NULL, if none exists or search has been stopped)
+    T* next(void);
+    /// Return statistics
+    Search::Statistics statistics(void) const;
+    /// Check whether engine has been stopped
+    bool stopped(void) const;
+    /// Destructor
+    ~LDS(void);
+  };
+
+  /// Invoke limited discrepancy search engine for subclass \a T of space \a s with options \a o
+  template<class T>
+  T* lds(T* s, const Search::Options& o=Search::Options::def);
+
+
+
+  /**
+   * \brief Large neighbourhood search engine
+   *
+   * The engine first searches for a solution of \a s. Then it
+   * repeatedly explores neighbourhoods of the so-far best solution
+   * and returns better solutions as they are found.
+   *
+   * Additionally, \a s must implement the member functions
+   * \code virtual void constrain(const Space& b) \endcode
+   * and
+   * \code virtual bool slave(const Space& b, Support::RandomGenerator& r) \endcode
+   * A neighbourhood is a copy of \a s that has been constrained
+   * to be better than the so-far best solution \a b (using \c constrain)
+   * and that has then been restricted to a neighbourhood
+   * of \a b (using \c slave, see Space::slave). Each neighbourhood
+   * is explored depth-first until a better solution has been found, the
+   * neighbourhood has been explored exhaustively, or more failures than
+   * the limit \a f_l (see Search::Options) have been encountered.
+   *
+   * The search ends when a complete neighbourhood has been explored
+   * exhaustively (then the so-far best solution is optimal) or when
+   * the engine is stopped. As neighbourhoods are typically not
+   * complete, a stop object should be used.
+   *
+   * The parallel version explores different neighbourhoods in parallel.
+   * \ingroup TaskModelSearch
+   */
+  template<class T>
+  class LNS {
+  private:
+    /// The actual search engine
+    Search::Engine* e;
+  public:
+    /// Initialize engine for space \a s and options \a o
+    LNS(T* s, const Search::Options& o=Search::Options::def);
+    /// Return next better solution (NULL, if none exists or search has been stopped)
+    T* next(void);
+    /// Return statistics
+    Search::Statistics statistics(void) const;
+    /// Check whether engine has been stopped
+    bool stopped(void) const;
+    /// Destructor
+    ~LNS(void);
+  };
+
+
+
+  /**
+   * \brief Portfolio search engine
+   *
+   * The engine runs several assets in parallel, where each asset
+   * is a search engine of type \a E (one of DFS, LDS, BAB, Restart,
+   * and LNS) running in its own thread. The number of assets is defined
+   * by the option \a assets (see Search::Options). The assets
+   * are either copies of a root space \a s, where the member function
+   * \c asset(i) is executed for the copy for asset \f$i\f$ (see
+   * Space::asset), or they are given explicitly.
+   *
+   * As soon as an asset finds a solution or proves that no (better)
+   * solution exists, all other assets are stopped. When searching for
+   * all solutions (DFS and LDS), the asset that finds the first
+   * solution is used for finding further solutions. When searching
+   * for best solutions (BAB, Restart, and LNS), all assets continue and
+   * each asset is constrained by the best solution found so far
+   * by any asset.
+   *
+   * Only the asset with number zero uses the cutoff sequence
+   * (see Search::Options). Without thread support, only asset zero
+   * is used.
+   * \ingroup TaskModelSearch
+   */
+  template<class T, template<class> class E=DFS>
+  class Portfolio {
+  private:
+    /// The actual search engine
+    Search::Engine* e;
+  public:
+    /// Initialize engine with copies of space \a s as assets and options \a o
+    Portfolio(T* s, const Search::Options& o=Search::Options::def);
+    /**
+     * \brief Initialize engine with \a n assets \a a (taking ownership) and options \a o
+     *
+     * The assets are explored by different threads and hence must
+     * not share memory (that is, they must be cloned with \a share
+     * being false).
+     */
+    Portfolio(T** a, unsigned int n, 
+              const Search::Options& o=Search::Options::def);
+    /// Return next (better) solution (NULL, if none exists or search has been stopped)
+    T* next(void);
+    /// Return statistics
+    Search::Statistics statistics(void) const;
+    /// Check whether engine has been stopped
+    bool stopped(void) const;
+    /// Destructor
+    ~Portfolio(void);
+  };
+
 }
 
 #include <gecode/search/dfs.hpp>
 #include <gecode/search/bab.hpp>
 #include <gecode/search/restart.hpp>
+#include <gecode/search/lds.hpp>
+#include <gecode/search/lns.hpp>
+#include <gecode/search/portfolio.hpp>
 
 #endif
 
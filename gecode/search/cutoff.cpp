@@ -0,0 +1,123 @@
+/* -*- mode: C++; c-basic-offset: 2; indent-tabs-mode: nil -*- */
+/*
+ *  Main authors:
+ *     Christian Schulte <schulte@gecode.org>
+ *
+ *  Copyright:
+ *     Christian Schulte, 2011
+ *
+ *  Last modified:
+ *     $Date$ by $Author$
+ *     $Revision$
+ *
+ *  This file is part of Gecode, the generic constraint
+ *  development environment:
+ *     http://www.gecode.org
+ *
+ *  Permission is hereby granted, free of charge, to any person obtaining
+ *  a copy of this software and associated documentation files (the
+ *  "Software"), to deal in the Software without restriction, including
+ *  without limitation the rights to use, copy, modify, merge, publish,
+ *  distribute, sublicense, and/or sell copies of the Software, and to
+ *  permit persons to whom the Software is furnished to do so, subject to
+ *  the following conditions:
+ *
+ *  The above copyright notice and this permission notice shall be
+ *  included in all copies or substantial portions of the Software.
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ *  EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ *  MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ *  NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE
+ *  LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+ *  OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+ *  WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ */
+
+#include <gecode/search.hh>
+
+namespace Gecode { namespace Search {
+
+  /*
+   * Creation of cutoff sequences
+   *
+   */
+  Cutoff*
+  Cutoff::constant(unsigned long int scale) {
+    return new CutoffConstant(scale);
+  }
+  Cutoff*
+  Cutoff::linear(unsigned long int scale) {
+    return new CutoffLinear(scale);
+  }
+  Cutoff*
+  Cutoff::luby(unsigned long int scale) {
+    return new CutoffLuby(scale);
+  }
+  Cutoff*
+  Cutoff::geometric(unsigned long int scale, double base) {
+    return new CutoffGeometric(scale,base);
+  }
+
+
+  /*
+   * Constant cutoff sequence
+   *
+   */
+  unsigned long int
+  CutoffConstant::operator ()(void) const {
+    return c;
+  }
+  unsigned long int
+  CutoffConstant::operator ++(void) {
+    return c;
+  }
+
+
+  /*
+   * Linear cutoff sequence
+   *
+   */
+  unsigned long int
+  CutoffLinear::operator ()(void) const {
+    return n;
+  }
+  unsigned long int
+  CutoffLinear::operator ++(void) {
+    n += s;
+    return n;
+  }
+
+
+  /*
+   * Luby cutoff sequence
+   *
+   */
+  unsigned long int
+  CutoffLuby::operator ()(void) const {
+    return s * luby(i);
+  }
+  unsigned long int
+  CutoffLuby::operator ++(void) {
+    return s * luby(++i);
+  }
+
+
+  /*
+   * Geometric cutoff sequence
+   *
+   */
+  unsigned long int
+  CutoffGeometric::operator ()(void) const {
+    return static_cast<unsigned long int>(n);
+  }
+  unsigned long int
+  CutoffGeometric::operator ++(void) {
+    n *= b;
+    return static_cast<unsigned long int>(n);
+  }
+
+}}
+
+// STATISTICS: search-other
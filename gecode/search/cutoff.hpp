@@ -0,0 +1,108 @@
+/* -*- mode: C++; c-basic-offset: 2; indent-tabs-mode: nil -*- */
+/*
+ *  Main authors:
+ *     Christian Schulte <schulte@gecode.org>
+ *
+ *  Copyright:
+ *     Christian Schulte, 2011
+ *
+ *  Last modified:
+ *     $Date$ by $Author$
+ *     $Revision$
+ *
+ *  This file is part of Gecode, the generic constraint
+ *  development environment:
+ *     http://www.gecode.org
+ *
+ *  Permission is hereby granted, free of charge, to any person obtaining
+ *  a copy of this software and associated documentation files (the
+ *  "Software"), to deal in the Software without restriction, including
+ *  without limitation the rights to use, copy, modify, merge, publish,
+ *  distribute, sublicense, and/or sell copies of the Software, and to
+ *  permit persons to whom the Software is furnished to do so, subject to
+ *  the following conditions:
+ *
+ *  The above copyright notice and this permission notice shall be
+ *  included in all copies or substantial portions of the Software.
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ *  EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ *  MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ *  NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE
+ *  LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+ *  OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+ *  WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ */
+
+namespace Gecode { namespace Search {
+
+  /*
+   * Base class
+   *
+   */
+  forceinline
+  Cutoff::Cutoff(void) {}
+
+  forceinline
+  Cutoff::~Cutoff(void) {}
+
+
+
+  /*
+   * Constant cutoff sequence
+   *
+   */
+
+  forceinline
+  CutoffConstant::CutoffConstant(unsigned long int c0) : c(c0) {}
+
+
+
+  /*
+   * Linear cutoff sequence
+   *
+   */
+
+  forceinline
+  CutoffLinear::CutoffLinear(unsigned long int s0) : s(s0), n(s0) {}
+
+
+
+  /*
+   * Luby cutoff sequence
+   *
+   */
+
+  forceinline
+  CutoffLuby::CutoffLuby(unsigned long int s0) : s(s0), i(1) {}
+
+  forceinline unsigned long int
+  CutoffLuby::luby(unsigned long int i) {
+    while (true) {
+      // Find k such that 2^(k-1) <= i < 2^k
+      unsigned long int k = 1;
+      while ((1UL << k) <= i)
+        k++;
+      if (i == (1UL << k) - 1)
+        return 1UL << (k-1);
+      i -= (1UL << (k-1)) - 1;
+    }
+    GECODE_NEVER;
+    return 0;
+  }
+
+
+
+  /*
+   * Geometric cutoff sequence
+   *
+   */
+
+  forceinline
+  CutoffGeometric::CutoffGeometric(unsigned long int s, double b0)
+    : n(static_cast<double>(s)), b(b0) {}
+
+}}
+
+// STATISTICS: search-other
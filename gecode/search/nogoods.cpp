@@ -0,0 +1,116 @@
+/* -*- mode: C++; c-basic-offset: 2; indent-tabs-mode: nil -*- */
+/*
+ *  Main authors:
+ *     Christian Schulte <schulte@gecode.org>
+ *
+ *  Copyright:
+ *     Christian Schulte, 2011
+ *
+ *  Last modified:
+ *     $Date$ by $Author$
+ *     $Revision$
+ *
+ *  This file is part of Gecode, the generic constraint
+ *  development environment:
+ *     http://www.gecode.org
+ *
+ *  Permission is hereby granted, free of charge, to any person obtaining
+ *  a copy of this software and associated documentation files (the
+ *  "Software"), to deal in the Software without restriction, including
+ *  without limitation the rights to use, copy, modify, merge, publish,
+ *  distribute, sublicense, and/or sell copies of the Software, and to
+ *  permit persons to whom the Software is furnished to do so, subject to
+ *  the following conditions:
+ *
+ *  The above copyright notice and this permission notice shall be
+ *  included in all copies or substantial portions of the Software.
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ *  EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ *  MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ *  NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE
+ *  LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+ *  OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+ *  WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ */
+
+#include <gecode/search/nogoods.hh>
+
+namespace Gecode { namespace Search {
+
+  forceinline
+  NoGoodsProp::NoGoodsProp(Space& home, NGL* l)
+    : Propagator(home), root(l) {
+    root->subscribe(home,*this);
+  }
+
+  forceinline
+  NoGoodsProp::NoGoodsProp(Space& home, bool share, NoGoodsProp& p)
+    : Propagator(home,share,p) {
+    root = NULL;
+    NGL* c = NULL;
+    for (NGL* l = p.root; l != NULL; l = l->next()) {
+      NGL* n = l->copy(home,share);
+      n->leaf(l->leaf());
+      if (c == NULL)
+        root = n;
+      else
+        c->next(n);
+      c = n;
+    }
+  }
+
+  Actor*
+  NoGoodsProp::copy(Space& home, bool share) {
+    return new (home) NoGoodsProp(home,share,*this);
+  }
+
+  PropCost
+  NoGoodsProp::cost(const Space&, const ModEventDelta&) const {
+    return PropCost::unary(PropCost::LO);
+  }
+
+  ExecStatus
+  NoGoodsProp::propagate(Space& home, const ModEventDelta&) {
+    switch (root->status(home)) {
+    case NGL::NONE:
+      return ES_FIX;
+    case NGL::FAILED:
+      return home.ES_SUBSUMED(*this);
+    case NGL::SUBSUMED:
+      root->cancel(home,*this);
+      root = dispose(home,root);
+      GECODE_ES_CHECK(simplify(home,root));
+      if (root == NULL)
+        return home.ES_SUBSUMED(*this);
+      root->subscribe(home,*this);
+      return ES_FIX;
+    default:
+      GECODE_NEVER;
+    }
+    return ES_FIX;
+  }
+
+  ExecStatus
+  NoGoodsProp::post(Space& home, NGL* l) {
+    GECODE_ES_CHECK(simplify(home,l));
+    if (l != NULL)
+      (void) new (home) NoGoodsProp(home,l);
+    return ES_OK;
+  }
+
+  size_t
+  NoGoodsProp::dispose(Space& home) {
+    if (root != NULL) {
+      root->cancel(home,*this);
+      while (root != NULL)
+        root = dispose(home,root);
+    }
+    (void) Propagator::dispose(home);
+    return sizeof(*this);
+  }
+
+}}
+
+// STATISTICS: search-other
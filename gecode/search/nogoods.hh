@@ -0,0 +1,122 @@
+/* -*- mode: C++; c-basic-offset: 2; indent-tabs-mode: nil -*- */
+/*
+ *  Main authors:
+ *     Christian Schulte <schulte@gecode.org>
+ *
+ *  Copyright:
+ *     Christian Schulte, 2011
+ *
+ *  Last modified:
+ *     $Date$ by $Author$
+ *     $Revision$
+ *
+ *  This file is part of Gecode, the generic constraint
+ *  development environment:
+ *     http://www.gecode.org
+ *
+ *  Permission is hereby granted, free of charge, to any person obtaining
+ *  a copy of this software and associated documentation files (the
+ *  "Software"), to deal in the Software without restriction, including
+ *  without limitation the rights to use, copy, modify, merge, publish,
+ *  distribute, sublicense, and/or sell copies of the Software, and to
+ *  permit persons to whom the Software is furnished to do so, subject to
+ *  the following conditions:
+ *
+ *  The above copyright notice and this permission notice shall be
+ *  included in all copies or substantial portions of the Software.
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ *  EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ *  MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ *  NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE
+ *  LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+ *  OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+ *  WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ */
+
+#ifndef __GECODE_SEARCH_NOGOODS_HH__
+#define __GECODE_SEARCH_NOGOODS_HH__
+
+#include <gecode/search.hh>
+
+namespace Gecode { namespace Search {
+
+  /**
+   * \brief Propagator for nogoods recorded from a search path
+   *
+   * The nogoods are stored as a single list of literals: a path literal
+   * describes the alternative taken at a choice on the path, leaf
+   * literals (which precede the path literal of the same choice)
+   * describe the alternatives that have been explored exhaustively.
+   * Each leaf literal \f$l\f$ stands for the nogood
+   * \f$\neg(p_1\wedge\cdots\wedge p_k\wedge l)\f$ where
+   * \f$p_1,\ldots,p_k\f$ are the path literals before \f$l\f$.
+   *
+   * As long as the first path literal is neither subsumed nor failed
+   * nothing can be propagated: hence only the first path literal
+   * is subscribed to.
+   */
+  class NoGoodsProp : public Propagator {
+  protected:
+    /// First literal, always a path literal with status NGL::NONE
+    NGL* root;
+    /// Constructor for creation
+    NoGoodsProp(Space& home, NGL* root);
+    /// Constructor for cloning \a p
+    NoGoodsProp(Space& home, bool share, NoGoodsProp& p);
+    /// Dispose literal \a l and return its successor
+    static NGL* dispose(Space& home, NGL* l);
+    /// Remove subsumed path literals and prune leaf literals at head of \a l
+    static ExecStatus simplify(Space& home, NGL*& l);
+  public:
+    /// Perform copying during cloning
+    virtual Actor* copy(Space& home, bool share);
+    /// Cost function (only the first literal is ever inspected)
+    virtual PropCost cost(const Space& home, const ModEventDelta& med) const;
+    /// Perform propagation
+    virtual ExecStatus propagate(Space& home, const ModEventDelta& med);
+    /// Post propagator for list of literals \a l
+    static ExecStatus post(Space& home, NGL* l);
+    /// Delete propagator and return its size
+    virtual size_t dispose(Space& home);
+  };
+
+  forceinline NGL*
+  NoGoodsProp::dispose(Space& home, NGL* l) {
+    NGL* n = l->next();
+    home.rfree(l,l->dispose(home));
+    return n;
+  }
+
+  forceinline ExecStatus
+  NoGoodsProp::simplify(Space& home, NGL*& l) {
+    while (l != NULL)
+      if (l->leaf()) {
+        // All path literals before are subsumed, so l must not hold
+        GECODE_ES_CHECK(l->prune(home));
+        l = dispose(home,l);
+      } else {
+        switch (l->status(home)) {
+        case NGL::SUBSUMED:
+          l = dispose(home,l);
+          break;
+        case NGL::FAILED:
+          // All remaining nogoods are satisfied
+          while (l != NULL)
+            l = dispose(home,l);
+          return ES_OK;
+        case NGL::NONE:
+          return ES_OK;
+        default:
+          GECODE_NEVER;
+        }
+      }
+    return ES_OK;
+  }
+
+}}
+
+#endif
+
+// STATISTICS: search-other
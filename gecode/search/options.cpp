@@ -38,6 +38,7 @@
 #include <gecode/search.hh>
 
 #include <cmath>
+#include <climits>
 
 namespace Gecode { namespace Search {
 
@@ -45,6 +46,12 @@ namespace Gecode { namespace Search {
 
   Options
   Options::expand(void) const {
+    Options o(*this);
+    if (restore == RS_RECOMPUTE) {
+      // Never copy during exploration nor during recomputation
+      o.c_d = UINT_MAX;
+      o.a_d = UINT_MAX;
+    }
 #ifdef GECODE_HAS_THREADS
     double t = threads;
     if (t <= -1.0) {
@@ -59,12 +66,9 @@ namespace Gecode { namespace Search {
     t = floor(t+0.5);
     if (t < 1.0)
       t = 1.0;
-    Options o(*this);
     o.threads = t;
-    return o;
-#else
-    return *this;
 #endif
+    return o;
   }
 
 }}
@@ -42,6 +42,11 @@ namespace Gecode { namespace Search {
     : clone(Config::clone), 
       threads(Config::threads), 
       c_d(Config::c_d), a_d(Config::a_d), 
+      affinity(Config::affinity), restore(Config::restore),
+      d_l(Config::d_l),
+      cutoff(NULL), nogoods_limit(Config::nogoods_limit),
+      learn(Config::learn),
+      f_l(Config::f_l), assets(Config::assets),
       stop(NULL) {}
 
 }}
@@ -62,6 +62,8 @@ namespace Gecode { namespace Search { namespace Parallel {
     // Peform initial delay, if not first worker
     if (this != engine().worker(0))
       Support::Thread::sleep(Config::initial_delay);
+    // Bind thread to processing units, if requested
+    bind();
     // Okay, we are in business, start working
     while (true) {
       switch (engine().cmd()) {
@@ -74,6 +76,8 @@ namespace Gecode { namespace Search { namespace Parallel {
         engine().ack_terminate();
         // Wait until termination can proceed
         engine().wait_terminate();
+        // Release binding as the thread is reused by other workers
+        unbind();
         // Terminate thread
         engine().terminated();
         return;
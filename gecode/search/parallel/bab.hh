@@ -124,6 +124,9 @@ namespace Gecode { namespace Search { namespace Parallel {
     // All other workers start with no work
     for (unsigned int i=1; i<workers(); i++)
       _worker[i] = new Worker(NULL,sz,*this);
+    // Initialize victim selection and placement
+    for (unsigned int i=0; i<workers(); i++)
+      _worker[i]->init(i);
     // Block all workers
     block();
     // Create and start threads
@@ -177,10 +180,18 @@ namespace Gecode { namespace Search { namespace Parallel {
    */
   forceinline void
   BAB::Worker::find(void) {
-    // Try to find new work (even if there is none)
-    for (unsigned int i=0; i<engine().workers(); i++) {
+    /*
+     * Try to find new work (even if there is none), starting with a
+     * random victim. Victims on the same NUMA node are tried first.
+     */
+    unsigned int n = engine().workers();
+    unsigned int o = victim(n);
+    for (unsigned int i=0; i<2*n; i++) {
+      Worker* v = engine().worker((o+i) % n);
+      if ((v == this) || (local(*v) != (i < n)))
+        continue;
       unsigned long int r_d = 0ul;
-      if (Space* s = engine().worker(i)->steal(r_d)) {
+      if (Space* s = v->steal(r_d)) {
         // Reset this guy
         m.acquire();
         idle = false;
@@ -191,9 +202,12 @@ namespace Gecode { namespace Search { namespace Parallel {
           cur->constrain(*best);
         Search::Worker::reset(cur,r_d);
         m.release();
+        stolen(true);
         return;
       }
     }
+    // Nothing found, wait a little before trying again
+    stolen(false);
   }
 
 }}}
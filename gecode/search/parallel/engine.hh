@@ -55,6 +55,16 @@ namespace Gecode { namespace Search { namespace Parallel {
       Engine& _engine;
       /// Mutex for access to worker
       Support::Mutex m;
+      /// Mutex to admit only a single thief at a time
+      Support::Mutex m_steal;
+      /// Random number generator for victim selection
+      Support::RandomGenerator rnd;
+      /// Current delay (in milliseconds) after unsuccessful stealing
+      unsigned int backoff;
+      /// Processing unit the worker runs on (if bound)
+      unsigned int pu;
+      /// NUMA node the worker runs on (if bound)
+      unsigned int numa;
       /// Current path ins search tree
       Path path;
       /// Current space being explored
@@ -68,6 +78,18 @@ namespace Gecode { namespace Search { namespace Parallel {
       Worker(Space* s, size_t sz, Engine& e);
       /// Hand over some work (NULL if no work available)
       Space* steal(unsigned long int& d);
+      /// Initialize victim selection and placement for worker number \a i
+      void init(unsigned int i);
+      /// Bind executing thread according to the affinity option
+      void bind(void);
+      /// Release binding of executing thread
+      void unbind(void);
+      /// Test whether worker \a w runs on the same NUMA node
+      bool local(const Worker& w) const;
+      /// Return index of random victim among \a n workers
+      unsigned int victim(unsigned int n);
+      /// Wait after unsuccessful search for work (\a ok is false) or reset
+      void stolen(bool ok);
       /// Return statistics
       Statistics statistics(void);
       /// Provide access to engine
@@ -237,7 +259,8 @@ namespace Gecode { namespace Search { namespace Parallel {
    */
   forceinline
   Engine::Worker::Worker(Space* s, size_t sz, Engine& e)
-    : Search::Worker(sz), _engine(e), d(0), idle(false) {
+    : Search::Worker(sz), _engine(e), backoff(0), pu(0), numa(0),
+      d(0), idle(false) {
     current(s);
     if (s != NULL) {
       if (s->status(*this) == SS_FAILED) {
@@ -392,6 +415,50 @@ namespace Gecode { namespace Search { namespace Parallel {
   /*
    * Worker: finding and stealing working
    */
+  forceinline void
+  Engine::Worker::init(unsigned int i) {
+    rnd.seed(i+1);
+    if (engine().opt().affinity != AFF_NONE) {
+      pu = i % Support::Thread::npu();
+      numa = Support::Thread::node(pu);
+    }
+  }
+
+  forceinline void
+  Engine::Worker::bind(void) {
+    if (engine().opt().affinity != AFF_NONE)
+      Support::Thread::bind(pu,engine().opt().affinity == AFF_NODE);
+  }
+
+  forceinline void
+  Engine::Worker::unbind(void) {
+    if (engine().opt().affinity != AFF_NONE)
+      Support::Thread::unbind();
+  }
+
+  forceinline bool
+  Engine::Worker::local(const Worker& w) const {
+    return numa == w.numa;
+  }
+
+  forceinline unsigned int
+  Engine::Worker::victim(unsigned int n) {
+    return rnd(n);
+  }
+
+  forceinline void
+  Engine::Worker::stolen(bool ok) {
+    if (ok) {
+      backoff = 0;
+    } else {
+      // Exponential backoff, bounded by the configured maximum
+      Support::Thread::sleep(backoff);
+      backoff = 2*backoff+1;
+      if (backoff > Config::steal_backoff)
+        backoff = Config::steal_backoff;
+    }
+  }
+
   forceinline Space*
   Engine::Worker::steal(unsigned long int& d) {
     /*
@@ -402,9 +469,17 @@ namespace Gecode { namespace Search { namespace Parallel {
      */
     if (!path.steal())
       return NULL;
+    /*
+     * Only one thief at a time waits for the worker: any other thief
+     * tries a different victim rather than queueing up on the mutex,
+     * which would block the worker once for each thief in turn.
+     */
+    if (!m_steal.tryacquire())
+      return NULL;
     m.acquire();
     Space* s = path.steal(*this,d);
     m.release();
+    m_steal.release();
     // Tell that there will be one more busy worker
     if (s != NULL) 
       engine().busy();
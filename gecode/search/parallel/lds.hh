@@ -0,0 +1,195 @@
+/* -*- mode: C++; c-basic-offset: 2; indent-tabs-mode: nil -*- */
+/*
+ *  Main authors:
+ *     Christian Schulte <schulte@gecode.org>
+ *
+ *  Copyright:
+ *     Christian Schulte, 2011
+ *
+ *  Last modified:
+ *     $Date$ by $Author$
+ *     $Revision$
+ *
+ *  This file is part of Gecode, the generic constraint
+ *  development environment:
+ *     http://www.gecode.org
+ *
+ *  Permission is hereby granted, free of charge, to any person obtaining
+ *  a copy of this software and associated documentation files (the
+ *  "Software"), to deal in the Software without restriction, including
+ *  without limitation the rights to use, copy, modify, merge, publish,
+ *  distribute, sublicense, and/or sell copies of the Software, and to
+ *  permit persons to whom the Software is furnished to do so, subject to
+ *  the following conditions:
+ *
+ *  The above copyright notice and this permission notice shall be
+ *  included in all copies or substantial portions of the Software.
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ *  EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ *  MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ *  NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE
+ *  LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+ *  OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+ *  WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ */
+
+#ifndef __GECODE_SEARCH_PARALLEL_LDS_HH__
+#define __GECODE_SEARCH_PARALLEL_LDS_HH__
+
+#include <gecode/search/parallel/engine.hh>
+
+namespace Gecode { namespace Search { namespace Parallel {
+
+  /**
+   * \brief %Parallel limited discrepancy search engine
+   *
+   * Rather than sharing nodes by work stealing, the workers share
+   * the iterations: worker \f$i\f$ out of \f$n\f$ workers runs the
+   * iterations with \f$i, i+n, i+2n, \ldots\f$ discrepancies, each
+   * starting from its own copy of the root space.
+   */
+  class LDS : public Engine {
+  protected:
+    /// %Parallel limited discrepancy search worker
+    class Worker : public Engine::Worker {
+    protected:
+      /// Root space to start iterations from
+      Space* root;
+      /// Number of discrepancies for current iteration
+      unsigned int d_cur;
+      /// Number of discrepancies taken by current path
+      unsigned int d_used;
+      /// Whether current iteration has excluded alternatives
+      bool cut;
+    public:
+      /// Initialize for space \a s (of size \a sz) with engine \a e
+      Worker(Space* s, size_t sz, LDS& e);
+      /// Provide access to engine
+      LDS& engine(void) const;
+      /// Initialize as worker \a i with root space \a r (unless already present)
+      void init(unsigned int i, const Space* r);
+      /// Return root space
+      const Space* space(void) const;
+      /// Start execution of worker
+      virtual void run(void);
+      /// Start next iteration and return whether there is one
+      bool iterate(void);
+      /// Destructor
+      virtual ~Worker(void);
+    };
+    /// Array of worker references
+    Worker** _worker;
+  public:
+    /// Provide access to worker \a i
+    Worker* worker(unsigned int i) const;
+
+    /// \name Search control
+    //@{
+    /// Report solution \a s
+    void solution(Space* s);
+    //@}
+
+    /// \name Engine interface
+    //@{
+    /// Initialize for space \a s (of size \a sz) with options \a o
+    LDS(Space* s, size_t sz, const Options& o);
+    /// Return statistics
+    virtual Statistics statistics(void) const;
+    /// Destructor
+    virtual ~LDS(void);
+    //@}
+  };
+
+
+  /*
+   * Basic access routines
+   */
+  forceinline LDS&
+  LDS::Worker::engine(void) const {
+    return static_cast<LDS&>(_engine);
+  }
+  forceinline LDS::Worker*
+  LDS::worker(unsigned int i) const {
+    return _worker[i];
+  }
+  forceinline const Space*
+  LDS::Worker::space(void) const {
+    return root;
+  }
+
+
+  /*
+   * Engine: initialization
+   */
+  forceinline
+  LDS::Worker::Worker(Space* s, size_t sz, LDS& e)
+    : Engine::Worker(s,sz,e), 
+      root(cur), d_cur(0), d_used(0), cut(false) {
+    // The root space is only used for creating copies
+    current(NULL);
+    cur = NULL;
+  }
+  forceinline void
+  LDS::Worker::init(unsigned int i, const Space* r) {
+    Engine::Worker::init(i);
+    if ((root == NULL) && (r != NULL))
+      root = r->clone(false);
+    d_cur = i;
+    if ((root != NULL) && (d_cur <= engine().opt().d_l)) {
+      cur = root->clone(false);
+      current(cur);
+    }
+  }
+  forceinline
+  LDS::LDS(Space* s, size_t sz, const Options& o)
+    : Engine(o) {
+    // Create workers
+    _worker = static_cast<Worker**>
+      (heap.ralloc(workers() * sizeof(Worker*)));
+    // The first worker performs the initial propagation
+    _worker[0] = new Worker(s,sz,*this);
+    for (unsigned int i=1; i<workers(); i++)
+      _worker[i] = new Worker(NULL,sz,*this);
+    // Each worker gets its own copy of the root space
+    for (unsigned int i=0; i<workers(); i++)
+      _worker[i]->init(i,_worker[0]->space());
+    // Block all workers
+    block();
+    // Create and start threads
+    for (unsigned int i=0; i<workers(); i++)
+      Support::Thread::run(_worker[i]);
+  }
+
+
+  /*
+   * Engine: search control
+   */
+  forceinline void 
+  LDS::solution(Space* s) {
+    m_search.acquire();
+    bool bs = signal();
+    solutions.push(s);
+    if (bs)
+      e_search.signal();
+    m_search.release();
+  }
+
+  forceinline bool
+  LDS::Worker::iterate(void) {
+    unsigned int n = engine().workers();
+    // Only continue if the last iteration has excluded something
+    if (!cut || (d_cur + n > engine().opt().d_l))
+      return false;
+    d_cur += n; d_used = 0; d = 0; cut = false;
+    cur = root->clone(false);
+    current(cur);
+    return true;
+  }
+
+}}}
+
+#endif
+
+// STATISTICS: search-parallel
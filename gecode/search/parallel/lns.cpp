@@ -0,0 +1,204 @@
+/* -*- mode: C++; c-basic-offset: 2; indent-tabs-mode: nil -*- */
+/*
+ *  Main authors:
+ *     Christian Schulte <schulte@gecode.org>
+ *
+ *  Copyright:
+ *     Christian Schulte, 2011
+ *
+ *  Last modified:
+ *     $Date$ by $Author$
+ *     $Revision$
+ *
+ *  This file is part of Gecode, the generic constraint
+ *  development environment:
+ *     http://www.gecode.org
+ *
+ *  Permission is hereby granted, free of charge, to any person obtaining
+ *  a copy of this software and associated documentation files (the
+ *  "Software"), to deal in the Software without restriction, including
+ *  without limitation the rights to use, copy, modify, merge, publish,
+ *  distribute, sublicense, and/or sell copies of the Software, and to
+ *  permit persons to whom the Software is furnished to do so, subject to
+ *  the following conditions:
+ *
+ *  The above copyright notice and this permission notice shall be
+ *  included in all copies or substantial portions of the Software.
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ *  EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ *  MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ *  NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE
+ *  LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+ *  OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+ *  WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ */
+
+
+#include <gecode/support.hh>
+
+#ifdef GECODE_HAS_THREADS
+
+#include <gecode/search/parallel/lns.hh>
+
+namespace Gecode { namespace Search { namespace Parallel {
+
+  /*
+   * Statistics
+   */
+  Statistics 
+  LNS::statistics(void) const {
+    Statistics s;
+    for (unsigned int i=0; i<workers(); i++)
+      s += worker(i)->statistics();
+    return s;
+  }
+
+
+  /*
+   * Engine: search control
+   */
+  void
+  LNS::Worker::run(void) {
+    // Bind thread to processing units, if requested
+    bind();
+    // Okay, we are in business, start working
+    while (true) {
+      switch (engine().cmd()) {
+      case C_WAIT:
+        // Wait
+        engine().wait();
+        break;
+      case C_TERMINATE:
+        // Acknowledge termination request
+        engine().ack_terminate();
+        // Wait until termination can proceed
+        engine().wait_terminate();
+        // Release binding as the thread is reused by other workers
+        unbind();
+        // Terminate thread
+        engine().terminated();
+        return;
+      case C_RESET:
+        // Acknowledge reset request
+        engine().ack_reset_start();
+        // Wait until reset has been performed
+        engine().wait_reset();
+        // Acknowledge that reset cycle is over
+        engine().ack_reset_stop();
+        break;
+      case C_WORK:
+        // Perform exploration work
+        {
+          m.acquire();
+          if (idle) {
+            m.release();
+            // Search is done, wait until the other workers are done
+            stolen(false);
+          } else if (engine().done()) {
+            idle = true;
+            m.release();
+            // Report that worker is idle
+            engine().idle();
+          } else if (cur != NULL) {
+            start();
+            if (stop(engine().opt(),path.size())) {
+              // Report stop
+              m.release();
+              engine().stop();
+            } else if ((best != NULL) && (fail > limit)) {
+              // Failure limit exceeded, give up on neighbourhood
+              delete cur;
+              cur = NULL;
+              path.reset();
+              complete = false;
+              Worker::current(NULL);
+              m.release();
+            } else {
+              node++;
+              switch (cur->status(*this)) {
+              case SS_FAILED:
+                fail++;
+                delete cur;
+                cur = NULL;
+                Worker::current(NULL);
+                m.release();
+                break;
+              case SS_SOLVED:
+                {
+                  // Deletes all pending branchers
+                  (void) cur->choice();
+                  Space* s = cur->clone(false);
+                  delete cur;
+                  cur = NULL;
+                  // Continue with a neighbourhood of the new solution
+                  path.reset();
+                  complete = false;
+                  Worker::current(NULL);
+                  m.release();
+                  engine().solution(s);
+                }
+                break;
+              case SS_BRANCH:
+                {
+                  Space* c;
+                  if ((d == 0) || (d >= engine().opt().c_d)) {
+                    c = cur->clone();
+                    d = 1;
+                  } else {
+                    c = NULL;
+                    d++;
+                  }
+                  const Choice* ch = path.push(*this,cur,c);
+                  Worker::push(c,ch);
+                  cur->commit(*ch,0);
+                  m.release();
+                }
+                break;
+              default:
+                GECODE_NEVER;
+              }
+            }
+          } else if (path.next(*this)) {
+            cur = path.recompute(d,engine().opt().a_d,*this);
+            Worker::current(cur);
+            m.release();
+          } else if (complete) {
+            // The current neighbourhood has been explored exhaustively
+            complete = false;
+            unsigned long int ev = v;
+            m.release();
+            engine().exhausted(ev);
+          } else {
+            m.release();
+            neighbourhood();
+          }
+        }
+        break;
+      default:
+        GECODE_NEVER;
+      }
+    }
+  }
+
+
+  /*
+   * Termination and deletion
+   */
+  LNS::Worker::~Worker(void) {
+    delete root;
+    delete best;
+  }
+
+  LNS::~LNS(void) {
+    terminate();
+    delete best;
+    heap.rfree(_worker);
+  }
+
+}}}
+
+#endif
+
+// STATISTICS: search-parallel
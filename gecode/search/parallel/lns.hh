@@ -0,0 +1,258 @@
+/* -*- mode: C++; c-basic-offset: 2; indent-tabs-mode: nil -*- */
+/*
+ *  Main authors:
+ *     Christian Schulte <schulte@gecode.org>
+ *
+ *  Copyright:
+ *     Christian Schulte, 2011
+ *
+ *  Last modified:
+ *     $Date$ by $Author$
+ *     $Revision$
+ *
+ *  This file is part of Gecode, the generic constraint
+ *  development environment:
+ *     http://www.gecode.org
+ *
+ *  Permission is hereby granted, free of charge, to any person obtaining
+ *  a copy of this software and associated documentation files (the
+ *  "Software"), to deal in the Software without restriction, including
+ *  without limitation the rights to use, copy, modify, merge, publish,
+ *  distribute, sublicense, and/or sell copies of the Software, and to
+ *  permit persons to whom the Software is furnished to do so, subject to
+ *  the following conditions:
+ *
+ *  The above copyright notice and this permission notice shall be
+ *  included in all copies or substantial portions of the Software.
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ *  EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ *  MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ *  NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE
+ *  LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+ *  OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+ *  WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ */
+
+
+#ifndef __GECODE_SEARCH_PARALLEL_LNS_HH__
+#define __GECODE_SEARCH_PARALLEL_LNS_HH__
+
+#include <gecode/search/parallel/engine.hh>
+
+namespace Gecode { namespace Search { namespace Parallel {
+
+  /**
+   * \brief %Parallel large neighbourhood search engine
+   *
+   * Rather than sharing nodes by work stealing, the workers explore
+   * different neighbourhoods of the so-far best solution. The first
+   * worker searches for the first solution, the other workers wait
+   * until a first solution has been found.
+   */
+  class LNS : public Engine {
+  protected:
+    /// %Parallel large neighbourhood search worker
+    class Worker : public Engine::Worker {
+    protected:
+      /// Root space to create neighbourhoods from
+      Space* root;
+      /// Solution the current neighbourhood has been created for
+      Space* best;
+      /// Version of the solution the current neighbourhood has been created for
+      unsigned long int v;
+      /// Failure limit for the current neighbourhood
+      unsigned long int limit;
+      /// Whether the current neighbourhood is complete
+      bool complete;
+    public:
+      /// Initialize for space \a s (of size \a sz) with engine \a e
+      Worker(Space* s, size_t sz, LNS& e);
+      /// Provide access to engine
+      LNS& engine(void) const;
+      /// Initialize as worker \a i with root space \a r (unless already present)
+      void init(unsigned int i, const Space* r);
+      /// Return root space
+      const Space* space(void) const;
+      /// Start execution of worker
+      virtual void run(void);
+      /// Start exploring a new neighbourhood of the so-far best solution
+      void neighbourhood(void);
+      /// Destructor
+      virtual ~Worker(void);
+    };
+    /// Array of worker references
+    Worker** _worker;
+    /// Best solution so far
+    Space* best;
+    /// Version of best solution (incremented for each better solution)
+    unsigned long int version;
+    /// Whether search is done
+    volatile bool _done;
+  public:
+    /// Provide access to worker \a i
+    Worker* worker(unsigned int i) const;
+
+    /// \name Search control
+    //@{
+    /// Report solution \a s
+    void solution(Space* s);
+    /// Return copy of best solution (NULL if none) and its version \a v
+    Space* incumbent(unsigned long int& v);
+    /// Report that a complete neighbourhood for version \a v has been explored
+    void exhausted(unsigned long int v);
+    /// Test whether search is done
+    bool done(void) const;
+    //@}
+
+    /// \name Engine interface
+    //@{
+    /// Initialize for space \a s (of size \a sz) with options \a o
+    LNS(Space* s, size_t sz, const Options& o);
+    /// Return statistics
+    virtual Statistics statistics(void) const;
+    /// Destructor
+    virtual ~LNS(void);
+    //@}
+  };
+
+
+  /*
+   * Basic access routines
+   */
+  forceinline LNS&
+  LNS::Worker::engine(void) const {
+    return static_cast<LNS&>(_engine);
+  }
+  forceinline LNS::Worker*
+  LNS::worker(unsigned int i) const {
+    return _worker[i];
+  }
+  forceinline const Space*
+  LNS::Worker::space(void) const {
+    return root;
+  }
+  forceinline bool
+  LNS::done(void) const {
+    return _done;
+  }
+
+
+  /*
+   * Engine: initialization
+   */
+  forceinline
+  LNS::Worker::Worker(Space* s, size_t sz, LNS& e)
+    : Engine::Worker(s,sz,e), root(NULL), best(NULL), v(0), limit(0),
+      complete(cur != NULL) {
+    // The first worker searches for the first solution
+    if (cur != NULL)
+      root = cur->clone(false);
+  }
+  forceinline void
+  LNS::Worker::init(unsigned int i, const Space* r) {
+    Engine::Worker::init(i);
+    if ((root == NULL) && (r != NULL))
+      root = r->clone(false);
+  }
+  forceinline
+  LNS::LNS(Space* s, size_t sz, const Options& o)
+    : Engine(o), best(NULL), version(0), _done(false) {
+    // Create workers
+    _worker = static_cast<Worker**>
+      (heap.ralloc(workers() * sizeof(Worker*)));
+    // The first worker performs the initial propagation
+    _worker[0] = new Worker(s,sz,*this);
+    for (unsigned int i=1; i<workers(); i++)
+      _worker[i] = new Worker(NULL,sz,*this);
+    // Each worker gets its own copy of the root space
+    for (unsigned int i=0; i<workers(); i++)
+      _worker[i]->init(i,_worker[0]->space());
+    // No solution exists if the root space is failed
+    _done = (_worker[0]->space() == NULL);
+    // Block all workers
+    block();
+    // Create and start threads
+    for (unsigned int i=0; i<workers(); i++)
+      Support::Thread::run(_worker[i]);
+  }
+
+
+  /*
+   * Engine: search control
+   */
+  forceinline void 
+  LNS::solution(Space* s) {
+    m_search.acquire();
+    if (best != NULL) {
+      // Solutions from outdated neighbourhoods might not be better
+      s->constrain(*best);
+      if (s->status() == SS_FAILED) {
+        delete s;
+        m_search.release();
+        return;
+      }
+      delete best;
+    }
+    best = s->clone(false);
+    version++;
+    bool bs = signal();
+    solutions.push(s);
+    if (bs)
+      e_search.signal();
+    m_search.release();
+  }
+  forceinline Space*
+  LNS::incumbent(unsigned long int& v) {
+    m_search.acquire();
+    Space* b = (best != NULL) ? best->clone(false) : NULL;
+    v = version;
+    m_search.release();
+    return b;
+  }
+  forceinline void
+  LNS::exhausted(unsigned long int v) {
+    m_search.acquire();
+    // Either no solution exists or the best solution is optimal
+    if (v == version)
+      _done = true;
+    m_search.release();
+  }
+
+  forceinline void
+  LNS::Worker::neighbourhood(void) {
+    unsigned long int nv;
+    Space* b = engine().incumbent(nv);
+    if (b == NULL) {
+      // Wait until the first solution has been found
+      stolen(false);
+      return;
+    }
+    Space* n = root->clone(false);
+    n->constrain(*b);
+    bool c = n->slave(*b,rnd);
+    m.acquire();
+    delete best;
+    best = b; v = nv; complete = c;
+    restart++;
+    d = 0;
+    if (n->status(*this) == SS_FAILED) {
+      fail++;
+      delete n;
+      cur = NULL;
+      Search::Worker::reset();
+    } else {
+      cur = n;
+      Search::Worker::reset(cur);
+    }
+    limit = fail + engine().opt().f_l;
+    m.release();
+    stolen(true);
+  }
+
+}}}
+
+#endif
+
+// STATISTICS: search-parallel
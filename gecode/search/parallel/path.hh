@@ -73,6 +73,8 @@ namespace Gecode { namespace Search { namespace Parallel {
       Edge(void);
       /// Edge for space \a s with clone \a c (possibly NULL)
       Edge(Space* s, Space* c);
+      /// Edge for space \a s with clone \a c exploring at most \a a alternatives
+      Edge(Space* s, Space* c, unsigned int a);
       
       /// Return space for edge
       Space* space(void) const;
@@ -106,6 +108,8 @@ namespace Gecode { namespace Search { namespace Parallel {
     Path(void);
     /// Push space \a c (a clone of \a s or NULL)
     const Choice* push(Worker& stat, Space* s, Space* c);
+    /// Push space \a c (a clone of \a s or NULL) exploring at most \a a alternatives
+    const Choice* push(Worker& stat, Space* s, Space* c, unsigned int a);
     /// Generate path for next node and return whether a next node exists
     bool next(Worker& s);
     /// Provide access to topmost edge
@@ -125,6 +129,8 @@ namespace Gecode { namespace Search { namespace Parallel {
                      const Space* best, int& mark);
     /// Return number of entries on stack
     int entries(void) const;
+    /// Return number of discrepancies (sum of alternatives) of path
+    unsigned int discrepancies(void) const;
     /// Return size used
     size_t size(void) const;
     /// Reset stack
@@ -149,6 +155,14 @@ namespace Gecode { namespace Search { namespace Parallel {
     _alt_max = _choice->alternatives()-1;
   }
 
+  forceinline
+  Path::Edge::Edge(Space* s, Space* c, unsigned int a)
+    : _space(c), _alt(0), _choice(s->choice()) {
+    assert(a > 0);
+    _alt_max = (a < _choice->alternatives()) ?
+      a-1 : _choice->alternatives()-1;
+  }
+
   forceinline Space*
   Path::Edge::space(void) const {
     return _space;
@@ -211,6 +225,16 @@ namespace Gecode { namespace Search { namespace Parallel {
     return sn.choice();
   }
 
+  forceinline const Choice*
+  Path::push(Worker& stat, Space* s, Space* c, unsigned int a) {
+    Edge sn(s,c,a);
+    if (sn.work())
+      n_work++;
+    ds.push(sn);
+    stat.stack_depth(static_cast<unsigned long int>(ds.entries()));
+    return sn.choice();
+  }
+
   forceinline bool
   Path::next(Worker& stat) {
     while (!ds.empty())
@@ -257,6 +281,14 @@ namespace Gecode { namespace Search { namespace Parallel {
     return ds.entries();
   }
 
+  forceinline unsigned int
+  Path::discrepancies(void) const {
+    unsigned int n = 0;
+    for (int i=ds.entries(); i--; )
+      n += ds[i].alt();
+    return n;
+  }
+
   forceinline size_t
   Path::size(void) const {
     return ds.size();
@@ -0,0 +1,222 @@
+/* -*- mode: C++; c-basic-offset: 2; indent-tabs-mode: nil -*- */
+/*
+ *  Main authors:
+ *     Christian Schulte <schulte@gecode.org>
+ *
+ *  Copyright:
+ *     Christian Schulte, 2011
+ *
+ *  Last modified:
+ *     $Date$ by $Author$
+ *     $Revision$
+ *
+ *  This file is part of Gecode, the generic constraint
+ *  development environment:
+ *     http://www.gecode.org
+ *
+ *  Permission is hereby granted, free of charge, to any person obtaining
+ *  a copy of this software and associated documentation files (the
+ *  "Software"), to deal in the Software without restriction, including
+ *  without limitation the rights to use, copy, modify, merge, publish,
+ *  distribute, sublicense, and/or sell copies of the Software, and to
+ *  permit persons to whom the Software is furnished to do so, subject to
+ *  the following conditions:
+ *
+ *  The above copyright notice and this permission notice shall be
+ *  included in all copies or substantial portions of the Software.
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ *  EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ *  MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ *  NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE
+ *  LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+ *  OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+ *  WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ */
+
+
+#include <gecode/search/parallel/portfolio.hh>
+
+namespace Gecode { namespace Search { namespace Parallel {
+
+  /*
+   * Stop object for assets
+   */
+  bool
+  Portfolio::Stop::stop(const Statistics& s, const Options& o) {
+    u = (so != NULL) && so->stop(s,o);
+    return u || p.halt();
+  }
+
+
+  /*
+   * Jobs
+   */
+  void
+  Portfolio::Job::run(void) {
+    Space* s = a.e->next();
+    // The solution is handed to another thread
+    a.sol = (s != NULL) ? s->clone(false) : NULL;
+    delete s;
+    p.report(a);
+  }
+
+
+  /*
+   * The portfolio
+   */
+  Portfolio::Portfolio(Space** a, unsigned int n0, size_t sz, 
+                       const Options& o, Builder bld, 
+                       bool best0, bool complete0)
+    : n(n0), asset(heap.alloc<Asset>(n0)), best(best0), 
+      complete(complete0), winner(NULL), b(NULL), version(0), 
+      _halt(false), _stopped(false), done(false), n_busy(0),
+      order(heap.alloc<Asset*>(n0)), n_order(0), solutions(heap) {
+    for (unsigned int i=0; i<n; i++) {
+      asset[i].s = new Stop(*this,o.stop);
+      asset[i].sol = NULL;
+      asset[i].v = 0;
+      asset[i].finished = false;
+      // Each asset runs sequentially in its own thread
+      Options ao(o);
+      ao.threads = 1.0;
+      ao.clone = false;
+      ao.stop = asset[i].s;
+      if (i > 0)
+        ao.cutoff = NULL;
+      asset[i].e = bld(a[i],sz,ao);
+    }
+  }
+
+  void
+  Portfolio::report(Asset& a) {
+    m.acquire();
+    order[n_order++] = &a;
+    // Halt all other assets when the round is decided
+    if ((a.sol != NULL) || a.s->user() || (complete && !a.e->stopped()))
+      _halt = true;
+    bool last = (--n_busy == 0);
+    m.release();
+    if (last)
+      e_round.signal();
+  }
+
+  void
+  Portfolio::round(void) {
+    _halt = false;
+    n_order = 0;
+    n_busy = 0;
+    for (unsigned int i=0; i<n; i++)
+      if (!asset[i].finished)
+        n_busy++;
+    for (unsigned int i=0; i<n; i++)
+      if (!asset[i].finished)
+        Support::Thread::run(new Job(*this,asset[i]));
+    e_round.wait();
+  }
+
+  Space*
+  Portfolio::next(void) {
+    _stopped = false;
+    while (true) {
+      if (!solutions.empty())
+        return solutions.pop();
+      if (done)
+        return NULL;
+      if (winner != NULL) {
+        // Only the asset that found the first solution continues
+        _halt = false;
+        Space* s = winner->e->next();
+        if (s == NULL) {
+          if (winner->e->stopped())
+            _stopped = true;
+          else
+            done = true;
+        }
+        return s;
+      }
+      // Share the best solution found so far
+      if (best && (b != NULL))
+        for (unsigned int i=0; i<n; i++)
+          if (!asset[i].finished && (asset[i].v < version)) {
+            asset[i].e->constrain(*b);
+            asset[i].v = version;
+          }
+      round();
+      bool user = false;
+      for (unsigned int k=0; k<n_order; k++) {
+        Asset& a = *order[k];
+        if (a.sol != NULL) {
+          Space* s = a.sol;
+          a.sol = NULL;
+          if (!best) {
+            if (winner == NULL) {
+              winner = &a;
+              solutions.push(s);
+            } else {
+              delete s;
+            }
+          } else {
+            if (b != NULL) {
+              s->constrain(*b);
+              if (s->status() == SS_FAILED) {
+                delete s;
+                continue;
+              }
+              delete b;
+            }
+            b = s->clone(false);
+            a.v = ++version;
+            solutions.push(s);
+          }
+        } else if (a.s->user()) {
+          user = true;
+        } else if (!a.e->stopped()) {
+          a.finished = true;
+          if (complete)
+            done = true;
+        }
+      }
+      bool all = true;
+      for (unsigned int i=0; i<n; i++)
+        all &= asset[i].finished;
+      if (all)
+        done = true;
+      if (solutions.empty() && !done && user) {
+        _stopped = true;
+        return NULL;
+      }
+    }
+    GECODE_NEVER;
+    return NULL;
+  }
+
+  Statistics
+  Portfolio::statistics(void) const {
+    Statistics s;
+    for (unsigned int i=0; i<n; i++)
+      s += asset[i].e->statistics();
+    return s;
+  }
+
+  bool
+  Portfolio::stopped(void) const {
+    return _stopped;
+  }
+
+  Portfolio::~Portfolio(void) {
+    for (unsigned int i=0; i<n; i++) {
+      delete asset[i].e;
+      delete asset[i].s;
+    }
+    delete b;
+    while (!solutions.empty())
+      delete solutions.pop();
+    heap.free<Asset>(asset,n);
+    heap.free<Asset*>(order,n);
+  }
+
+}}}
+
+// STATISTICS: search-parallel
@@ -0,0 +1,175 @@
+/* -*- mode: C++; c-basic-offset: 2; indent-tabs-mode: nil -*- */
+/*
+ *  Main authors:
+ *     Christian Schulte <schulte@gecode.org>
+ *
+ *  Copyright:
+ *     Christian Schulte, 2011
+ *
+ *  Last modified:
+ *     $Date$ by $Author$
+ *     $Revision$
+ *
+ *  This file is part of Gecode, the generic constraint
+ *  development environment:
+ *     http://www.gecode.org
+ *
+ *  Permission is hereby granted, free of charge, to any person obtaining
+ *  a copy of this software and associated documentation files (the
+ *  "Software"), to deal in the Software without restriction, including
+ *  without limitation the rights to use, copy, modify, merge, publish,
+ *  distribute, sublicense, and/or sell copies of the Software, and to
+ *  permit persons to whom the Software is furnished to do so, subject to
+ *  the following conditions:
+ *
+ *  The above copyright notice and this permission notice shall be
+ *  included in all copies or substantial portions of the Software.
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ *  EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ *  MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ *  NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE
+ *  LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+ *  OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+ *  WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ */
+
+
+#ifndef __GECODE_SEARCH_PARALLEL_PORTFOLIO_HH__
+#define __GECODE_SEARCH_PARALLEL_PORTFOLIO_HH__
+
+#include <gecode/search.hh>
+
+namespace Gecode { namespace Search { namespace Parallel {
+
+  /// %Portfolio search engine running assets in parallel
+  class Portfolio : public Search::Engine {
+  protected:
+    /// Stop object for an asset
+    class Stop : public Search::Stop {
+    protected:
+      /// The portfolio
+      Portfolio& p;
+      /// The stop object provided by the user (might be NULL)
+      Search::Stop* so;
+      /// Whether the stop object provided by the user has stopped
+      bool u;
+    public:
+      /// Initialize for portfolio \a p and stop object \a so
+      Stop(Portfolio& p, Search::Stop* so);
+      /// Test whether the stop object provided by the user has stopped
+      bool user(void) const;
+      /// Stop if the user's stop object stops or the portfolio halts
+      virtual bool stop(const Statistics& s, const Options& o);
+    };
+    /// An asset of the portfolio
+    class Asset {
+    public:
+      /// The search engine of the asset
+      Search::Engine* e;
+      /// The stop object of the asset
+      Stop* s;
+      /// Solution found in the last round (or NULL)
+      Space* sol;
+      /// Version of the best solution the asset has been constrained by
+      unsigned long int v;
+      /// Whether the asset has finished
+      bool finished;
+    };
+    /// Runnable for executing an asset during a round
+    class Job : public Support::Runnable {
+    protected:
+      /// The portfolio
+      Portfolio& p;
+      /// The asset to run
+      Asset& a;
+    public:
+      /// Initialize for asset \a a of portfolio \a p
+      Job(Portfolio& p, Asset& a);
+      /// Search for the next solution of the asset
+      virtual void run(void);
+    };
+    /// Number of assets
+    unsigned int n;
+    /// The assets
+    Asset* asset;
+    /// Whether the assets search for best solutions
+    bool best;
+    /// Whether an asset that finishes proves that there are no solutions
+    bool complete;
+    /// Asset that found the first solution (all solution search)
+    Asset* winner;
+    /// Best solution found so far (best solution search)
+    Space* b;
+    /// Version of the best solution found so far
+    unsigned long int version;
+    /// Whether all assets must halt
+    volatile bool _halt;
+    /// Whether search has been stopped by the user's stop object
+    bool _stopped;
+    /// Whether search is done
+    bool done;
+    /// Mutex for reporting results
+    Support::Mutex m;
+    /// Event for signalling that all assets of a round have reported
+    Support::Event e_round;
+    /// Number of assets still running in the current round
+    unsigned int n_busy;
+    /// Assets in the order in which they have reported
+    Asset** order;
+    /// Number of assets that have reported in the current round
+    unsigned int n_order;
+    /// Queue of solutions
+    Support::DynamicQueue<Space*,Heap> solutions;
+    /// Report that asset \a a has finished its round
+    void report(Asset& a);
+    /// Run a round of all assets that have not finished
+    void round(void);
+  public:
+    /// Initialize for \a n assets \a a (of size \a sz) and options \a o
+    Portfolio(Space** a, unsigned int n, size_t sz, const Options& o,
+              Builder bld, bool best, bool complete);
+    /// Whether all assets must halt
+    bool halt(void) const;
+    /// Return next solution (NULL, if none exists or search has been stopped)
+    virtual Space* next(void);
+    /// Return statistics
+    virtual Statistics statistics(void) const;
+    /// Check whether engine has been stopped
+    virtual bool stopped(void) const;
+    /// Destructor
+    virtual ~Portfolio(void);
+  };
+
+
+  /*
+   * Stop object for assets
+   */
+  forceinline
+  Portfolio::Stop::Stop(Portfolio& p0, Search::Stop* so0)
+    : p(p0), so(so0), u(false) {}
+
+  forceinline bool
+  Portfolio::Stop::user(void) const {
+    return u;
+  }
+
+  forceinline bool
+  Portfolio::halt(void) const {
+    return _halt;
+  }
+
+
+  /*
+   * Jobs
+   */
+  forceinline
+  Portfolio::Job::Job(Portfolio& p0, Asset& a0)
+    : p(p0), a(a0) {}
+
+}}}
+
+#endif
+
+// STATISTICS: search-parallel
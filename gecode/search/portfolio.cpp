@@ -0,0 +1,94 @@
+/* -*- mode: C++; c-basic-offset: 2; indent-tabs-mode: nil -*- */
+/*
+ *  Main authors:
+ *     Christian Schulte <schulte@gecode.org>
+ *
+ *  Copyright:
+ *     Christian Schulte, 2011
+ *
+ *  Last modified:
+ *     $Date$ by $Author$
+ *     $Revision$
+ *
+ *  This file is part of Gecode, the generic constraint
+ *  development environment:
+ *     http://www.gecode.org
+ *
+ *  Permission is hereby granted, free of charge, to any person obtaining
+ *  a copy of this software and associated documentation files (the
+ *  "Software"), to deal in the Software without restriction, including
+ *  without limitation the rights to use, copy, modify, merge, publish,
+ *  distribute, sublicense, and/or sell copies of the Software, and to
+ *  permit persons to whom the Software is furnished to do so, subject to
+ *  the following conditions:
+ *
+ *  The above copyright notice and this permission notice shall be
+ *  included in all copies or substantial portions of the Software.
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ *  EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ *  MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ *  NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE
+ *  LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+ *  OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+ *  WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ */
+
+
+#include <gecode/search.hh>
+#ifdef GECODE_HAS_THREADS
+#include <gecode/search/parallel/portfolio.hh>
+#endif
+
+namespace Gecode { namespace Search {
+
+  Engine* 
+  portfolio(Space** a, unsigned int n, size_t sz, const Options& o,
+            Builder b, bool best, bool complete) {
+#ifdef GECODE_HAS_THREADS
+    if (n > 1)
+      return new Parallel::Portfolio(a,n,sz,o,b,best,complete);
+#else
+    (void) best; (void) complete;
+#endif
+    // A single asset is explored by its engine only
+    for (unsigned int i=1; i<n; i++)
+      delete a[i];
+    Options ao(o);
+    ao.clone = false;
+    return b(a[0],sz,ao);
+  }
+
+  Engine* 
+  portfolio(Space* s, size_t sz, const Options& o,
+            Builder b, bool best, bool complete) {
+#ifdef GECODE_HAS_THREADS
+    unsigned int n = o.assets;
+    if (n == 0)
+      n = static_cast<unsigned int>(o.expand().threads);
+#else
+    unsigned int n = 1;
+#endif
+    if ((n == 1) && !o.clone) {
+      // The space itself is the only asset
+      s->asset(0);
+      return b(s,sz,o);
+    }
+    // A failed space cannot be copied, the engine deals with it
+    if (s->status() == SS_FAILED)
+      return b(s,sz,o);
+    // Assets run in different threads and must not share memory
+    Space** a = heap.alloc<Space*>(n);
+    for (unsigned int i=0; i<n; i++)
+      a[i] = (o.clone || (i+1 < n)) ? s->clone(false) : s;
+    for (unsigned int i=0; i<n; i++)
+      a[i]->asset(i);
+    Engine* e = portfolio(a,n,sz,o,b,best,complete);
+    heap.free<Space*>(a,n);
+    return e;
+  }
+
+}}
+
+// STATISTICS: search-other
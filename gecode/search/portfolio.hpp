@@ -0,0 +1,193 @@
+/* -*- mode: C++; c-basic-offset: 2; indent-tabs-mode: nil -*- */
+/*
+ *  Main authors:
+ *     Christian Schulte <schulte@gecode.org>
+ *
+ *  Copyright:
+ *     Christian Schulte, 2011
+ *
+ *  Last modified:
+ *     $Date$ by $Author$
+ *     $Revision$
+ *
+ *  This file is part of Gecode, the generic constraint
+ *  development environment:
+ *     http://www.gecode.org
+ *
+ *  Permission is hereby granted, free of charge, to any person obtaining
+ *  a copy of this software and associated documentation files (the
+ *  "Software"), to deal in the Software without restriction, including
+ *  without limitation the rights to use, copy, modify, merge, publish,
+ *  distribute, sublicense, and/or sell copies of the Software, and to
+ *  permit persons to whom the Software is furnished to do so, subject to
+ *  the following conditions:
+ *
+ *  The above copyright notice and this permission notice shall be
+ *  included in all copies or substantial portions of the Software.
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ *  EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ *  MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ *  NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE
+ *  LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+ *  OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+ *  WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ */
+
+
+namespace Gecode {
+
+  namespace Search {
+
+    /// Function for creating a search engine for an asset
+    typedef Engine* (*Builder)(Space* s, size_t sz, const Options& o);
+
+    /**
+     * \brief Create portfolio engine with copies of \a s as assets
+     *
+     * The engines for the assets are created by \a b, \a best defines
+     * whether the engines search for best solutions, and \a complete
+     * defines whether an engine that finishes proves that there are 
+     * no (further) solutions.
+     */
+    GECODE_SEARCH_EXPORT Engine* 
+    portfolio(Space* s, size_t sz, const Options& o, 
+              Builder b, bool best, bool complete);
+    /**
+     * \brief Create portfolio engine for \a n assets \a a
+     *
+     * The engines for the assets are created by \a b, \a best defines
+     * whether the engines search for best solutions, and \a complete
+     * defines whether an engine that finishes proves that there are 
+     * no (further) solutions.
+     */
+    GECODE_SEARCH_EXPORT Engine* 
+    portfolio(Space** a, unsigned int n, size_t sz, const Options& o, 
+              Builder b, bool best, bool complete);
+
+    /// Traits for search engines used as assets in a portfolio
+    template<template<class> class E>
+    class PortfolioTraits {};
+
+    /// Traits for depth-first search
+    template<>
+    class PortfolioTraits<DFS> {
+    public:
+      /// Create engine
+      static Engine* engine(Space* s, size_t sz, const Options& o) {
+        return dfs(s,sz,o);
+      }
+      /// The engine searches for all solutions
+      static const bool best = false;
+      /// The engine explores the entire search tree
+      static const bool complete = true;
+    };
+
+    /// Traits for limited discrepancy search
+    template<>
+    class PortfolioTraits<LDS> {
+    public:
+      /// Create engine
+      static Engine* engine(Space* s, size_t sz, const Options& o) {
+        return lds(s,sz,o);
+      }
+      /// The engine searches for all solutions
+      static const bool best = false;
+      /// The engine might not explore the entire search tree
+      static const bool complete = false;
+    };
+
+    /// Traits for branch-and-bound search
+    template<>
+    class PortfolioTraits<BAB> {
+    public:
+      /// Create engine
+      static Engine* engine(Space* s, size_t sz, const Options& o) {
+        return bab(s,sz,o);
+      }
+      /// The engine searches for best solutions
+      static const bool best = true;
+      /// The engine explores the entire search tree
+      static const bool complete = true;
+    };
+
+    /// Traits for restart best solution search
+    template<>
+    class PortfolioTraits<Restart> {
+    public:
+      /// Create engine
+      static Engine* engine(Space* s, size_t sz, const Options& o) {
+        return restart(s,sz,o);
+      }
+      /// The engine searches for best solutions
+      static const bool best = true;
+      /// The engine explores the entire search tree
+      static const bool complete = true;
+    };
+
+    /// Traits for large neighbourhood search
+    template<>
+    class PortfolioTraits<LNS> {
+    public:
+      /// Create engine
+      static Engine* engine(Space* s, size_t sz, const Options& o) {
+        return lns(s,sz,o);
+      }
+      /// The engine searches for best solutions
+      static const bool best = true;
+      /// The engine only finishes after a complete neighbourhood
+      static const bool complete = true;
+    };
+
+  }
+
+  template<class T, template<class> class E>
+  forceinline
+  Portfolio<T,E>::Portfolio(T* s, const Search::Options& o)
+    : e(Search::portfolio(s,sizeof(T),o,
+                          &Search::PortfolioTraits<E>::engine,
+                          Search::PortfolioTraits<E>::best,
+                          Search::PortfolioTraits<E>::complete)) {}
+
+  template<class T, template<class> class E>
+  forceinline
+  Portfolio<T,E>::Portfolio(T** a, unsigned int n, 
+                            const Search::Options& o) {
+    Space** s = heap.alloc<Space*>(n);
+    for (unsigned int i=n; i--; )
+      s[i] = a[i];
+    e = Search::portfolio(s,n,sizeof(T),o,
+                          &Search::PortfolioTraits<E>::engine,
+                          Search::PortfolioTraits<E>::best,
+                          Search::PortfolioTraits<E>::complete);
+    heap.free<Space*>(s,n);
+  }
+
+  template<class T, template<class> class E>
+  forceinline T*
+  Portfolio<T,E>::next(void) {
+    return dynamic_cast<T*>(e->next());
+  }
+
+  template<class T, template<class> class E>
+  forceinline Search::Statistics
+  Portfolio<T,E>::statistics(void) const {
+    return e->statistics();
+  }
+
+  template<class T, template<class> class E>
+  forceinline bool
+  Portfolio<T,E>::stopped(void) const {
+    return e->stopped();
+  }
+
+  template<class T, template<class> class E>
+  forceinline
+  Portfolio<T,E>::~Portfolio(void) {
+    delete e;
+  }
+
+}
+
+// STATISTICS: search-other
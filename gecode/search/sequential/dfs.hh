@@ -47,7 +47,7 @@ namespace Gecode { namespace Search { namespace Sequential {
 
   /// Depth-first search engine implementation
   class DFS : public Worker {
-  private:
+  protected:
     /// Search options
     Options opt;
     /// Current path ins search tree
@@ -56,7 +56,10 @@ namespace Gecode { namespace Search { namespace Sequential {
     Space* cur;
     /// Distance until next clone
     unsigned int d;
-  protected:
+    /// Clone of the root for learning from failures (NULL if none)
+    Space* lr;
+    /// Learn from failure of the current node and backjump
+    void learn(void);
     /// Reset engine to restart at space \a s and return new root
     Space* reset(Space* s);
   public:
@@ -72,7 +75,7 @@ namespace Gecode { namespace Search { namespace Sequential {
 
   forceinline 
   DFS::DFS(Space* s, size_t sz, const Options& o)
-    : Worker(sz), opt(o), d(0) {
+    : Worker(sz), opt(o), d(0), lr(NULL) {
     current(s);
     if (s->status(*this) == SS_FAILED) {
       fail++;
@@ -81,6 +84,8 @@ namespace Gecode { namespace Search { namespace Sequential {
         delete s;
     } else {
       cur = snapshot(s,opt);
+      if (opt.learn > 0)
+        lr = cur->clone();
     }
     current(NULL);
     current(cur);
@@ -89,8 +94,10 @@ namespace Gecode { namespace Search { namespace Sequential {
   forceinline Space*
   DFS::reset(Space* s) {
     delete cur;
+    delete lr;
     path.reset();
     d = 0;
+    lr = NULL;
     if (s->status(*this) == SS_FAILED) {
       cur = NULL;
       Worker::reset();
@@ -98,10 +105,21 @@ namespace Gecode { namespace Search { namespace Sequential {
     } else {
       cur = s;
       Worker::reset(cur);
+      if (opt.learn > 0)
+        lr = cur->clone();
       return cur->clone();
     }
   }
 
+  forceinline void
+  DFS::learn(void) {
+    path.backjump(path.learn(*lr,*this),*this);
+    if (lr->failed()) {
+      // There are no solutions at all
+      delete lr; lr = NULL;
+    }
+  }
+
   forceinline Space*
   DFS::next(void) {
     start();
@@ -116,6 +134,9 @@ namespace Gecode { namespace Search { namespace Sequential {
           delete cur;
           cur = NULL;
           Worker::current(NULL);
+          if ((lr != NULL) && !path.empty() &&
+              (path.entries() <= static_cast<int>(opt.learn)))
+            learn();
           break;
         case SS_SOLVED:
           {
@@ -166,6 +187,7 @@ namespace Gecode { namespace Search { namespace Sequential {
   forceinline 
   DFS::~DFS(void) {
     delete cur;
+    delete lr;
     path.reset();
   }
 
@@ -0,0 +1,191 @@
+/* -*- mode: C++; c-basic-offset: 2; indent-tabs-mode: nil -*- */
+/*
+ *  Main authors:
+ *     Christian Schulte <schulte@gecode.org>
+ *
+ *  Copyright:
+ *     Christian Schulte, 2011
+ *
+ *  Last modified:
+ *     $Date$ by $Author$
+ *     $Revision$
+ *
+ *  This file is part of Gecode, the generic constraint
+ *  development environment:
+ *     http://www.gecode.org
+ *
+ *  Permission is hereby granted, free of charge, to any person obtaining
+ *  a copy of this software and associated documentation files (the
+ *  "Software"), to deal in the Software without restriction, including
+ *  without limitation the rights to use, copy, modify, merge, publish,
+ *  distribute, sublicense, and/or sell copies of the Software, and to
+ *  permit persons to whom the Software is furnished to do so, subject to
+ *  the following conditions:
+ *
+ *  The above copyright notice and this permission notice shall be
+ *  included in all copies or substantial portions of the Software.
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ *  EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ *  MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ *  NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE
+ *  LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+ *  OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+ *  WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ */
+
+#ifndef __GECODE_SEARCH_SEQUENTIAL_LDS_HH__
+#define __GECODE_SEARCH_SEQUENTIAL_LDS_HH__
+
+#include <gecode/search.hh>
+#include <gecode/search/support.hh>
+#include <gecode/search/worker.hh>
+#include <gecode/search/sequential/path.hh>
+
+namespace Gecode { namespace Search { namespace Sequential {
+
+  /**
+   * \brief Limited discrepancy search engine implementation
+   *
+   * Each iteration explores the tree by depth-first search with
+   * recomputation, where the alternatives of a choice are limited
+   * by the number of discrepancies still available. Only solutions
+   * with exactly as many discrepancies as the current iteration allows
+   * are reported, solutions with fewer discrepancies have already
+   * been reported by an earlier iteration.
+   */
+  class LDS : public Worker {
+  private:
+    /// Search options
+    Options opt;
+    /// Current path ins search tree
+    Path path;
+    /// Root space to start iterations from
+    Space* root;
+    /// Current space being explored
+    Space* cur;
+    /// Distance until next clone
+    unsigned int d;
+    /// Number of discrepancies for current iteration
+    unsigned int d_cur;
+    /// Number of discrepancies taken by current path
+    unsigned int d_used;
+    /// Whether current iteration has excluded alternatives
+    bool cut;
+  public:
+    /// Initialize for space \a s (of size \a sz) with options \a o
+    LDS(Space* s, size_t sz, const Options& o);
+    /// %Search for next solution
+    Space* next(void);
+    /// Return statistics
+    Statistics statistics(void) const;
+    /// Destructor
+    ~LDS(void);
+  };
+
+  forceinline 
+  LDS::LDS(Space* s, size_t sz, const Options& o)
+    : Worker(sz), opt(o), d(0), d_cur(0), d_used(0), cut(false) {
+    current(s);
+    if (s->status(*this) == SS_FAILED) {
+      fail++;
+      root = cur = NULL;
+      if (!o.clone)
+        delete s;
+    } else {
+      root = snapshot(s,opt);
+      cur = root->clone();
+    }
+    current(NULL);
+    current(cur);
+  }
+
+  forceinline Space*
+  LDS::next(void) {
+    start();
+    while (true) {
+      while (cur) {
+        if (stop(opt,path.size()))
+          return NULL;
+        node++;
+        switch (cur->status(*this)) {
+        case SS_FAILED:
+          fail++;
+          delete cur;
+          cur = NULL;
+          Worker::current(NULL);
+          break;
+        case SS_SOLVED:
+          {
+            // Deletes all pending branchers
+            (void) cur->choice();
+            Space* s = cur;
+            cur = NULL;
+            Worker::current(NULL);
+            if (d_used == d_cur)
+              return s;
+            // Has already been reported by an earlier iteration
+            delete s;
+            break;
+          }
+        case SS_BRANCH:
+          {
+            Space* c;
+            if ((d == 0) || (d >= opt.c_d)) {
+              c = cur->clone();
+              d = 1;
+            } else {
+              c = NULL;
+              d++;
+            }
+            // Alternative a takes a discrepancies
+            unsigned int a = d_cur - d_used + 1;
+            const Choice* ch = path.push(*this,cur,c,a);
+            if (ch->alternatives() > a)
+              cut = true;
+            Worker::push(c,ch);
+            cur->commit(*ch,0);
+            break;
+          }
+        default:
+          GECODE_NEVER;
+        }
+      }
+      do {
+        if (!path.next(*this)) {
+          // Only continue if the last iteration has excluded something
+          if (!cut || (d_cur >= opt.d_l))
+            return NULL;
+          d_cur++; d_used = 0; d = 0; cut = false;
+          cur = root->clone();
+          break;
+        }
+        cur = path.recompute(d,opt.a_d,*this);
+        d_used = path.discrepancies();
+      } while (cur == NULL);
+      Worker::current(cur);
+    }
+    GECODE_NEVER;
+    return NULL;
+  }
+
+  forceinline Statistics
+  LDS::statistics(void) const {
+    Statistics s = *this;
+    s.memory += path.size();
+    return s;
+  }
+
+  forceinline 
+  LDS::~LDS(void) {
+    delete cur;
+    delete root;
+    path.reset();
+  }
+
+}}}
+
+#endif
+
+// STATISTICS: search-sequential
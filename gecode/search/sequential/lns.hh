@@ -0,0 +1,145 @@
+/* -*- mode: C++; c-basic-offset: 2; indent-tabs-mode: nil -*- */
+/*
+ *  Main authors:
+ *     Christian Schulte <schulte@gecode.org>
+ *
+ *  Copyright:
+ *     Christian Schulte, 2011
+ *
+ *  Last modified:
+ *     $Date$ by $Author$
+ *     $Revision$
+ *
+ *  This file is part of Gecode, the generic constraint
+ *  development environment:
+ *     http://www.gecode.org
+ *
+ *  Permission is hereby granted, free of charge, to any person obtaining
+ *  a copy of this software and associated documentation files (the
+ *  "Software"), to deal in the Software without restriction, including
+ *  without limitation the rights to use, copy, modify, merge, publish,
+ *  distribute, sublicense, and/or sell copies of the Software, and to
+ *  permit persons to whom the Software is furnished to do so, subject to
+ *  the following conditions:
+ *
+ *  The above copyright notice and this permission notice shall be
+ *  included in all copies or substantial portions of the Software.
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ *  EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ *  MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ *  NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE
+ *  LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+ *  OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+ *  WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ */
+
+
+#ifndef __GECODE_SEARCH_SEQUENTIAL_LNS_HH__
+#define __GECODE_SEARCH_SEQUENTIAL_LNS_HH__
+
+#include <gecode/search/sequential/restart.hh>
+
+namespace Gecode { namespace Search { namespace Sequential {
+
+  /// Large neighbourhood search engine implementation
+  class LNS : public DFS {
+  protected:
+    /// Root node
+    Space* root;
+    /// So-far best solution
+    Space* best;
+    /// Stop object for the failure limit of a neighbourhood
+    CutoffStop* cs;
+    /// Random number generator for selecting neighbourhoods
+    Support::RandomGenerator r;
+    /// Whether the current neighbourhood is complete
+    bool complete;
+    /// Start exploring a new neighbourhood of the so-far best solution
+    void neighbourhood(void);
+  public:
+    /// Initialize engine for space \a s (with size \a sz) and options \a o
+    LNS(Space* s, size_t sz, const Search::Options& o);
+    /// Return next better solution (NULL, if none exists or search has been stopped)
+    Space* next(void);
+    /// Constrain future solutions to be better than \a b
+    void constrain(const Space& b);
+    /// Destructor
+    ~LNS(void);
+  };
+
+  forceinline 
+  LNS::LNS(Space* s, size_t sz, const Search::Options& o)
+    : DFS(s,sz,o), root((cur == NULL) ? NULL : cur->clone()), best(NULL),
+      cs(new CutoffStop(o.stop)), complete(true) {}
+
+  forceinline void
+  LNS::neighbourhood(void) {
+    restart++;
+    Space* n = root->clone();
+    n->constrain(*best);
+    complete = n->slave(*best,r);
+    delete cur;
+    path.reset();
+    d = 0;
+    if (n->status(*this) == SS_FAILED) {
+      fail++;
+      delete n;
+      cur = NULL;
+      Worker::reset();
+    } else {
+      cur = n;
+      Worker::reset(cur);
+    }
+    // From now on, the search in each neighbourhood is limited
+    opt.stop = cs;
+    cs->limit(fail + opt.f_l);
+  }
+
+  forceinline Space*
+  LNS::next(void) {
+    while (true) {
+      Space* s = DFS::next();
+      if (s != NULL) {
+        delete best;
+        best = s;
+        Space* b = best->clone();
+        neighbourhood();
+        return b;
+      }
+      // The search for the first solution is not limited
+      if ((best == NULL) || cs->user())
+        return NULL;
+      // A complete neighbourhood has been explored: best is optimal
+      if (!stopped() && complete)
+        return NULL;
+      start();
+      neighbourhood();
+    }
+    GECODE_NEVER;
+    return NULL;
+  }
+
+  forceinline void
+  LNS::constrain(const Space& b) {
+    if (root == NULL)
+      return;
+    delete best;
+    best = b.clone(false);
+    // Continue with a neighbourhood of b
+    neighbourhood();
+  }
+
+  forceinline 
+  LNS::~LNS(void) {
+    delete best;
+    delete root;
+    delete cs;
+  }
+
+}}}
+
+#endif
+
+// STATISTICS: search-sequential
@@ -39,6 +39,7 @@
 #define __GECODE_SEARCH_SEQUENTIAL_PATH_HH__
 
 #include <gecode/search.hh>
+#include <gecode/search/nogoods.hh>
 
 namespace Gecode { namespace Search { namespace Sequential {
 
@@ -64,6 +65,8 @@ namespace Gecode { namespace Search { namespace Sequential {
       Space* _space;
       /// Current alternative
       unsigned int _alt;
+      /// Last alternative to be explored
+      unsigned int _alt_max;
       /// Choice
       const Choice* _choice;
     public:
@@ -71,6 +74,8 @@ namespace Gecode { namespace Search { namespace Sequential {
       Edge(void);
       /// Edge for space \a s with clone \a c (possibly NULL)
       Edge(Space* s, Space* c);
+      /// Edge for space \a s with clone \a c exploring at most \a a alternatives
+      Edge(Space* s, Space* c, unsigned int a);
       
       /// Return space for edge
       Space* space(void) const;
@@ -98,6 +103,8 @@ namespace Gecode { namespace Search { namespace Sequential {
     Path(void);
     /// Push space \a c (a clone of \a s or NULL)
     const Choice* push(Worker& stat, Space* s, Space* c);
+    /// Push space \a c (a clone of \a s or NULL) exploring at most \a a alternatives
+    const Choice* push(Worker& stat, Space* s, Space* c, unsigned int a);
     /// Generate path for next node and return whether a next node exists
     bool next(Worker& s);
     /// Provide access to topmost edge
@@ -117,6 +124,16 @@ namespace Gecode { namespace Search { namespace Sequential {
                      const Space* best, int& mark);
     /// Return number of entries on stack
     int entries(void) const;
+    /// Return number of discrepancies (sum of alternatives) of path
+    unsigned int discrepancies(void) const;
+    /// Post nogoods for the path up to depth \a l in \a home and return their number
+    unsigned int nogoods(Space& home, unsigned int l) const;
+    /// Post nogood for decisions \a ng at positions \a i to \a l-1 in \a home and return whether \a home is not failed
+    bool nogood(Space& home, const bool* ng, int i, int l, Worker& s) const;
+    /// Learn nogood from failure of path with root \a r and return number of entries to keep
+    int learn(Space& r, Worker& s);
+    /// Backjump by removing all but the first \a l entries
+    void backjump(int l, Worker& s);
     /// Return size used
     size_t size(void) const;
     /// Reset stack
@@ -133,7 +150,17 @@ namespace Gecode { namespace Search { namespace Sequential {
 
   forceinline
   Path::Edge::Edge(Space* s, Space* c)
-    : _space(c), _alt(0), _choice(s->choice()) {}
+    : _space(c), _alt(0), _choice(s->choice()) {
+    _alt_max = _choice->alternatives()-1;
+  }
+
+  forceinline
+  Path::Edge::Edge(Space* s, Space* c, unsigned int a)
+    : _space(c), _alt(0), _choice(s->choice()) {
+    assert(a > 0);
+    _alt_max = (a < _choice->alternatives()) ?
+      a-1 : _choice->alternatives()-1;
+  }
 
   forceinline Space*
   Path::Edge::space(void) const {
@@ -150,7 +177,7 @@ namespace Gecode { namespace Search { namespace Sequential {
   }
   forceinline bool
   Path::Edge::rightmost(void) const {
-    return _alt+1 == _choice->alternatives();
+    return _alt == _alt_max;
   }
   forceinline void
   Path::Edge::next(void) {
@@ -186,6 +213,14 @@ namespace Gecode { namespace Search { namespace Sequential {
     return sn.choice();
   }
 
+  forceinline const Choice*
+  Path::push(Worker& stat, Space* s, Space* c, unsigned int a) {
+    Edge sn(s,c,a);
+    ds.push(sn);
+    stat.stack_depth(static_cast<unsigned long int>(ds.entries()));
+    return sn.choice();
+  }
+
   forceinline bool
   Path::next(Worker& stat) {
     while (!ds.empty())
@@ -229,6 +264,138 @@ namespace Gecode { namespace Search { namespace Sequential {
     return ds.entries();
   }
 
+  forceinline unsigned int
+  Path::discrepancies(void) const {
+    unsigned int n = 0;
+    for (int i=ds.entries(); i--; )
+      n += ds[i].alt();
+    return n;
+  }
+
+  forceinline unsigned int
+  Path::nogoods(Space& home, unsigned int l) const {
+    unsigned int n = 0;
+    // List of literals for the nogoods
+    NGL* f = NULL; NGL* c = NULL;
+    // Path literals not yet followed by a leaf literal
+    NGL* pf = NULL; NGL* pc = NULL;
+    int s = std::min(ds.entries(),static_cast<int>(l));
+    for (int i=0; i<s; i++) {
+      const Edge& e = ds[i];
+      for (unsigned int a=0; a<e.alt(); a++) {
+        NGL* ll = home.ngl(*e.choice(),a);
+        if (ll == NULL)
+          continue;
+        ll->leaf(true);
+        if (pf != NULL) {
+          if (f == NULL) f = pf; else c->next(pf);
+          c = pc; pf = pc = NULL;
+        }
+        if (f == NULL) f = ll; else c->next(ll);
+        c = ll; n++;
+      }
+      NGL* p = home.ngl(*e.choice(),e.alt());
+      if (p == NULL)
+        break;
+      if (pf == NULL) pf = p; else pc->next(p);
+      pc = p;
+    }
+    while (pf != NULL) {
+      NGL* p = pf->next();
+      home.rfree(pf,pf->dispose(home));
+      pf = p;
+    }
+    if ((f != NULL) && (NoGoodsProp::post(home,f) == ES_FAILED))
+      home.fail();
+    return n;
+  }
+
+  forceinline bool
+  Path::nogood(Space& home, const bool* ng, int i, int l, Worker& stat) const {
+    NGL* f = NULL; NGL* c = NULL;
+    for (int k=i; k<l; k++)
+      if (ng[k]) {
+        NGL* p = home.ngl(*ds[k].choice(),ds[k].alt());
+        if (p == NULL) {
+          // No literal available, do not post the nogood
+          while (f != NULL) {
+            NGL* n = f->next();
+            home.rfree(f,f->dispose(home));
+            f = n;
+          }
+          return true;
+        }
+        if (f == NULL) f = p; else c->next(p);
+        c = p;
+      }
+    if (f == NULL) {
+      // The empty nogood
+      home.fail();
+    } else {
+      c->leaf(true);
+      if (NoGoodsProp::post(home,f) == ES_FAILED)
+        home.fail();
+    }
+    return home.status(stat) != SS_FAILED;
+  }
+
+  forceinline int
+  Path::learn(Space& r, Worker& stat) {
+    int n = ds.entries();
+    // Whether the decision at a position belongs to the nogood
+    bool* ng = heap.alloc<bool>(n);
+    for (int i=n; i--; )
+      ng[i] = true;
+    // Root with the decisions kept so far
+    Space* p = r.clone();
+    // Remove all decisions that are not needed for failure
+    for (int i=0; i<n; i++) {
+      Space* s = p->clone();
+      for (int j=i+1; j<n; j++)
+        commit(s,j);
+      bool f = (s->status(stat) == SS_FAILED);
+      delete s;
+      if (f) {
+        ng[i] = false;
+      } else {
+        commit(p,i);
+        if (p->status(stat) == SS_FAILED) {
+          // The remaining decisions are not needed
+          for (int j=i+1; j<n; j++)
+            ng[j] = false;
+          break;
+        }
+      }
+    }
+    delete p;
+    // Position after the deepest decision in the nogood
+    int l = n;
+    while ((l > 0) && !ng[l-1])
+      l--;
+    stat.nogood++;
+    if (l == 0) {
+      // The root fails
+      r.fail();
+    } else {
+      // Spaces on the path that fail can be discarded as well
+      for (int i=0; i<l; i++)
+        if ((ds[i].space() != NULL) &&
+            !nogood(*ds[i].space(),ng,i,l,stat)) {
+          l = i; break;
+        }
+    }
+    heap.free<bool>(ng,n);
+    return l;
+  }
+
+  forceinline void
+  Path::backjump(int l, Worker& stat) {
+    while (ds.entries() > l) {
+      stat.pop(ds.top().space(),ds.top().choice());
+      ds.pop().dispose();
+    }
+  }
+
   forceinline size_t
   Path::size(void) const {
     return ds.size();
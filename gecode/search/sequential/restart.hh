@@ -42,6 +42,26 @@
 
 namespace Gecode { namespace Search { namespace Sequential {
 
+  /// Stop object for stopping when the cutoff is exceeded
+  class CutoffStop : public Stop {
+  protected:
+    /// The stop object provided by the user (might be NULL)
+    Stop* so;
+    /// Failure limit
+    unsigned long int l;
+    /// Whether the stop object provided by the user has stopped
+    bool u;
+  public:
+    /// Initialize with stop object \a so (might be NULL)
+    CutoffStop(Stop* so);
+    /// Set the failure limit to \a l
+    void limit(unsigned long int l);
+    /// Test whether the stop object provided by the user has stopped
+    bool user(void) const;
+    /// Return true if either the user's stop object or the limit stops
+    virtual bool stop(const Statistics& s, const Options& o);
+  };
+
   /// Depth-first restart best solution search engine implementation
   class Restart : public DFS {
   protected:
@@ -49,37 +69,99 @@ namespace Gecode { namespace Search { namespace Sequential {
     Space* root;
     /// So-far best solution
     Space* best;
+    /// Stop object for the cutoff (NULL if no cutoff is used)
+    CutoffStop* cs;
+    /// Post nogoods for the current path into the root node
+    void nogoods(void);
   public:
     /// Initialize engine for space \a s (with size \a sz) and options \a o
     Restart(Space* s, size_t sz, const Search::Options& o);
     /// Return next better solution (NULL, if none exists or search has been stopped)
     Space* next(void);
+    /// Constrain future solutions to be better than \a b
+    void constrain(const Space& b);
     /// Destructor
     ~Restart(void);
   };
 
+  forceinline
+  CutoffStop::CutoffStop(Stop* so0)
+    : so(so0), l(0), u(false) {}
+
+  forceinline void
+  CutoffStop::limit(unsigned long int l0) {
+    l = l0;
+  }
+
+  forceinline bool
+  CutoffStop::user(void) const {
+    return u;
+  }
+
+  forceinline bool
+  CutoffStop::stop(const Statistics& s, const Options& o) {
+    u = (so != NULL) && so->stop(s,o);
+    return u || (s.fail > l);
+  }
+
+
   forceinline 
   Restart::Restart(Space* s, size_t sz, const Search::Options& o) :
     DFS(s,sz,o),
-    root(s->status() == SS_FAILED ? NULL : s->clone()), best(NULL) {}
+    root(s->status() == SS_FAILED ? NULL : s->clone()), best(NULL),
+    cs(NULL) {
+    if (o.cutoff != NULL) {
+      cs = new CutoffStop(o.stop);
+      cs->limit(fail + (*o.cutoff)());
+      opt.stop = cs;
+    }
+  }
+
+  forceinline void
+  Restart::nogoods(void) {
+    if (opt.nogoods_limit > 0)
+      nogood += path.nogoods(*root,opt.nogoods_limit);
+  }
 
   forceinline Space*
   Restart::next(void) {
     if (best != NULL) {
       root->constrain(*best);
+      if (cs != NULL)
+        nogoods();
+      root = reset(root);
+    }
+    while (root != NULL) {
+      delete best;
+      best = DFS::next();
+      if (best != NULL)
+        return best->clone();
+      if ((cs == NULL) || !stopped() || cs->user())
+        return NULL;
+      // The cutoff has been exceeded: restart
+      start();
+      restart++;
+      nogoods();
       root = reset(root);
+      cs->limit(fail + ++(*opt.cutoff));
     }
+    return NULL;
+  }
+
+  forceinline void
+  Restart::constrain(const Space& b) {
     if (root == NULL)
-      return NULL;
+      return;
+    // The next search restarts from the root constrained by b
     delete best;
-    best = DFS::next();
-    return (best != NULL) ? best->clone() : NULL;
+    best = b.clone(false);
   }
 
   forceinline 
   Restart::~Restart(void) {
     delete best;
     delete root;
+    delete cs;
   }
 
 }}}
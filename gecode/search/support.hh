@@ -62,6 +62,8 @@ namespace Gecode { namespace Search {
     virtual Search::Statistics statistics(void) const;
     /// Check whether engine has been stopped
     virtual bool stopped(void) const;
+    /// Constrain future solutions to be better than \a b
+    virtual void constrain(const Space& b);
   };
 
   template<class Worker>
@@ -83,6 +85,11 @@ namespace Gecode { namespace Search {
   WorkerToEngine<Worker>::stopped(void) const {
     return w.stopped();
   }
+  template<class Worker>
+  void 
+  WorkerToEngine<Worker>::constrain(const Space& b) {
+    w.constrain(b);
+  }
 
 }}
 
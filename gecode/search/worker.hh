@@ -66,6 +66,8 @@ namespace Gecode { namespace Search {
     bool stop(const Options& o, size_t sz);
     /// Check whether engine has been stopped
     bool stopped(void) const;
+    /// Constrain future solutions to be better than \a b (ignored)
+    void constrain(const Space& b);
     /// New space \a s and choice \a c get pushed on stack
     void push(const Space* s, const Choice* c);
     /// Space \a s1 is replaced by space \a s2 due to constraining
@@ -117,6 +119,9 @@ namespace Gecode { namespace Search {
     return _stopped;
   }
 
+  forceinline void
+  Worker::constrain(const Space&) {}
+
   forceinline void
   Worker::push(const Space* s, const Choice* c) {
     if (s != NULL)
@@ -148,6 +148,8 @@ namespace Gecode { namespace Set { namespace Branch {
     int val(Space& home, SetView x);
     /// Tell \f$x\leq n\f$ (\a a = 0) or \f$x\neq n\f$ (\a a = 1)
     ModEvent tell(Space& home, unsigned int a, SetView x, int n);
+    /// Return no-good literal (none as set literals are not supported)
+    NGL* ngl(Space& home, unsigned int a, SetView x, int n) const;
     /// Return choice
     Choice choice(Space& home);
     /// Return choice
@@ -74,10 +74,10 @@ namespace Gecode { namespace Support {
 #endif
     /// The bits
     Base bits;
+  public:
     /// Bits per base
     static const unsigned int bpb = 
       static_cast<unsigned int>(CHAR_BIT * sizeof(Base));
-  public:
     /// Initialize with all bits set if \a set
     void init(bool set=false);
     /// Get number of data elements for \a s bits
@@ -100,6 +100,14 @@ namespace Gecode { namespace Support {
     bool none(void) const;
     /// Whether no bits from bit 0 to bit \a i are set
     bool none(unsigned int i) const;
+    /// Perform "and" with \a a
+    void a(BitSetData a);
+    /// Perform "or" with \a a
+    void o(BitSetData a);
+    /// Remove all bits set in \a a
+    void d(BitSetData a);
+    /// Return "and" of \a a and \a b
+    static BitSetData a(BitSetData a, BitSetData b);
   };
 
   /// Status of a bitset
@@ -226,6 +234,24 @@ namespace Gecode { namespace Support {
     const Base mask = (static_cast<Base>(1U) << i) - static_cast<Base>(1U);
     return (bits & mask) == static_cast<Base>(0U);
   }
+  forceinline void
+  BitSetData::a(BitSetData a) {
+    bits &= a.bits;
+  }
+  forceinline void
+  BitSetData::o(BitSetData a) {
+    bits |= a.bits;
+  }
+  forceinline void
+  BitSetData::d(BitSetData a) {
+    bits &= ~a.bits;
+  }
+  forceinline BitSetData
+  BitSetData::a(BitSetData a, BitSetData b) {
+    BitSetData ab;
+    ab.bits = a.bits & b.bits;
+    return ab;
+  }
 
 
 
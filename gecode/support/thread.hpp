@@ -141,6 +141,25 @@ namespace Gecode { namespace Support {
     void operator=(const Lock&) {}
   };
 
+  /**
+   * \brief Atomic operations on counters
+   *
+   * If the platform does not provide atomic instructions, the
+   * operations are synchronized by a single global mutex.
+   *
+   * \ingroup FuncSupportThread
+   */
+  class Atomic {
+  private:
+    /// Mutex for platforms without atomic instructions
+    GECODE_SUPPORT_EXPORT static Mutex m;
+  public:
+    /// Atomically increment \a c and return the new value
+    static unsigned long int inc(volatile unsigned long int& c);
+    /// Atomically decrement \a c and return the new value
+    static unsigned long int dec(volatile unsigned long int& c);
+  };
+
   /**
    * \brief An event for synchronization
    * 
@@ -248,6 +267,18 @@ namespace Gecode { namespace Support {
     static void sleep(unsigned int ms);
     /// Return number of processing units (1 if information not available)
     static unsigned int npu(void);
+    /**
+     * \brief Bind calling thread to processing unit \a pu
+     *
+     * If \a node is true, the thread is bound to all processing
+     * units that belong to the same NUMA node as \a pu. If the
+     * platform does not support binding threads, nothing happens.
+     */
+    GECODE_SUPPORT_EXPORT static void bind(unsigned int pu, bool node);
+    /// Allow calling thread to run on all processing units again
+    GECODE_SUPPORT_EXPORT static void unbind(void);
+    /// Return NUMA node of processing unit \a pu (0 if information not available)
+    GECODE_SUPPORT_EXPORT static unsigned int node(unsigned int pu);
   private:
     /// A thread cannot be copied
     Thread(const Thread&) {}
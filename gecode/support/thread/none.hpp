@@ -54,6 +54,19 @@ namespace Gecode { namespace Support {
   Mutex::~Mutex(void) {}
 
 
+  /*
+   * Atomic operations
+   */
+  forceinline unsigned long int
+  Atomic::inc(volatile unsigned long int& c) {
+    return ++c;
+  }
+  forceinline unsigned long int
+  Atomic::dec(volatile unsigned long int& c) {
+    return --c;
+  }
+
+
   /*
    * Event
    */
@@ -39,6 +39,14 @@
 
 #ifdef GECODE_THREADS_PTHREADS
 
+#ifdef __linux__
+#include <sched.h>
+#include <dirent.h>
+#include <cstdio>
+#include <cstring>
+#include <cstdlib>
+#endif
+
 namespace Gecode { namespace Support {
 
   /// Function to start execution
@@ -58,6 +66,67 @@ namespace Gecode { namespace Support {
     if (pthread_create(&p_t, NULL, bootstrap, this) != 0)
       throw OperatingSystemError("Thread::run[pthread_create]");
   }
+
+  unsigned int
+  Thread::node(unsigned int pu) {
+#ifdef __linux__
+    // The node is given by a "node<n>" entry in the directory of the unit
+    char dn[64];
+    sprintf(dn, "/sys/devices/system/cpu/cpu%u", pu);
+    unsigned int n = 0;
+    if (DIR* d = opendir(dn)) {
+      while (struct dirent* e = readdir(d))
+        if (!strncmp(e->d_name,"node",4) &&
+            (e->d_name[4] >= '0') && (e->d_name[4] <= '9')) {
+          n = static_cast<unsigned int>(atoi(e->d_name+4));
+          break;
+        }
+      closedir(d);
+    }
+    return n;
+#else
+    (void) pu;
+    return 0;
+#endif
+  }
+
+  void
+  Thread::bind(unsigned int pu, bool node) {
+#if defined(__linux__) && defined(CPU_SET)
+    unsigned int n_pu = npu();
+    if (n_pu > CPU_SETSIZE)
+      n_pu = CPU_SETSIZE;
+    pu %= n_pu;
+    cpu_set_t cs;
+    CPU_ZERO(&cs);
+    if (node) {
+      unsigned int n = Thread::node(pu);
+      for (unsigned int i=0; i<n_pu; i++)
+        if (Thread::node(i) == n)
+          CPU_SET(i, &cs);
+    } else {
+      CPU_SET(pu, &cs);
+    }
+    // Not being able to bind is harmless, the thread just runs unbound
+    (void) pthread_setaffinity_np(pthread_self(), sizeof(cpu_set_t), &cs);
+#else
+    (void) pu; (void) node;
+#endif
+  }
+
+  void
+  Thread::unbind(void) {
+#if defined(__linux__) && defined(CPU_SET)
+    unsigned int n_pu = npu();
+    if (n_pu > CPU_SETSIZE)
+      n_pu = CPU_SETSIZE;
+    cpu_set_t cs;
+    CPU_ZERO(&cs);
+    for (unsigned int i=0; i<n_pu; i++)
+      CPU_SET(i, &cs);
+    (void) pthread_setaffinity_np(pthread_self(), sizeof(cpu_set_t), &cs);
+#endif
+  }
   
 }}
 
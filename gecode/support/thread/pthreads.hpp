@@ -70,6 +70,33 @@ namespace Gecode { namespace Support {
   }
 
 
+  /*
+   * Atomic operations
+   */
+  forceinline unsigned long int
+  Atomic::inc(volatile unsigned long int& c) {
+#ifdef __GNUC__
+    return __sync_add_and_fetch(&c,1UL);
+#else
+    m.acquire();
+    unsigned long int n = ++c;
+    m.release();
+    return n;
+#endif
+  }
+  forceinline unsigned long int
+  Atomic::dec(volatile unsigned long int& c) {
+#ifdef __GNUC__
+    return __sync_sub_and_fetch(&c,1UL);
+#else
+    m.acquire();
+    unsigned long int n = --c;
+    m.release();
+    return n;
+#endif
+  }
+
+
   /*
    * Event
    */
@@ -42,6 +42,7 @@ namespace Gecode { namespace Support {
   /*
    * Threads
    */
+  Mutex Atomic::m;
   Mutex Thread::m;
   Thread::Run* Thread::idle = NULL;
 
@@ -67,6 +68,19 @@ namespace Gecode { namespace Support {
     }
   }
 
+#ifndef GECODE_HAS_THREADS
+
+  void
+  Thread::bind(unsigned int, bool) {}
+  void
+  Thread::unbind(void) {}
+  unsigned int
+  Thread::node(unsigned int) {
+    return 0;
+  }
+
+#endif
+
 }}
 
 // STATISTICS: support-any
@@ -61,6 +61,25 @@ namespace Gecode { namespace Support {
       throw OperatingSystemError("Thread::run[Windows::CloseHandle]");
   }
 
+  unsigned int
+  Thread::node(unsigned int) {
+    return 0;
+  }
+
+  void
+  Thread::bind(unsigned int pu, bool) {
+    DWORD_PTR m = static_cast<DWORD_PTR>(1) << 
+      (pu % (sizeof(DWORD_PTR) * 8));
+    (void) SetThreadAffinityMask(GetCurrentThread(), m);
+  }
+
+  void
+  Thread::unbind(void) {
+    DWORD_PTR p, s;
+    if (GetProcessAffinityMask(GetCurrentProcess(), &p, &s))
+      (void) SetThreadAffinityMask(GetCurrentThread(), p);
+  }
+
 }}
 
 #endif
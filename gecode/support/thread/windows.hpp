@@ -62,6 +62,21 @@ namespace Gecode { namespace Support {
   }
 
 
+  /*
+   * Atomic operations
+   */
+  forceinline unsigned long int
+  Atomic::inc(volatile unsigned long int& c) {
+    return static_cast<unsigned long int>
+      (InterlockedIncrement(reinterpret_cast<volatile LONG*>(&c)));
+  }
+  forceinline unsigned long int
+  Atomic::dec(volatile unsigned long int& c) {
+    return static_cast<unsigned long int>
+      (InterlockedDecrement(reinterpret_cast<volatile LONG*>(&c)));
+  }
+
+
   /*
    * Event
    */
@@ -173,6 +173,7 @@ namespace Test { namespace Int {
     switch (epk) {
     case EPK_MEMORY: return "Memory";
     case EPK_SPEED:  return "Speed";
+    case EPK_COMPACT: return "Compact";
     default: return "Def";
     }
   }
@@ -435,6 +435,44 @@ namespace Test { namespace Int {
        }
      };
 
+     /// %Test for several clauses sharing variables
+     class ClauseCNF : public Test {
+     public:
+       /// Construct and register test
+       ClauseCNF(int n)
+         : Test("Bool::Clause::CNF::"+str(n),n,0,1) {}
+       /// Check whether \a x is solution
+       virtual bool solution(const Assignment& x) const {
+         int n = x.size();
+         for (int i=0; i<n; i++) {
+           if (!(x[i] || !x[(i+1) % n] || x[(i+2) % n]))
+             return false;
+           if (!(!x[i] || x[(i+1) % n] || !x[(i+3) % n]))
+             return false;
+         }
+         return x[0] || x[1];
+       }
+       /// Post constraint
+       virtual void post(Gecode::Space& home, Gecode::IntVarArray& x) {
+         using namespace Gecode;
+         int n = x.size();
+         BoolVarArgs b(n);
+         for (int i=n; i--; )
+           b[i]=channel(home,x[i]);
+         for (int i=0; i<n; i++) {
+           BoolVarArgs p(2), q(1);
+           p[0]=b[i]; p[1]=b[(i+2) % n]; q[0]=b[(i+1) % n];
+           clause(home, BOT_OR, p, q, 1);
+           BoolVarArgs r(1), s(2);
+           r[0]=b[(i+1) % n]; s[0]=b[i]; s[1]=b[(i+3) % n];
+           clause(home, BOT_AND, s, r, 0);
+         }
+         BoolVarArgs t(2);
+         t[0]=b[0]; t[1]=b[1];
+         rel(home, BOT_OR, t, 1);
+       }
+     };
+
      /// Help class to create and register tests
      class Create {
      public:
@@ -481,6 +519,9 @@ namespace Test { namespace Int {
              (void) new ClauseConst(bots.bot(),10,1);
            }
          }
+         (void) new ClauseCNF(4);
+         (void) new ClauseCNF(5);
+         (void) new ClauseCNF(8);
        }
      };
 
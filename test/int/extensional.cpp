@@ -41,6 +41,7 @@
 
 #include <gecode/minimodel.hh>
 #include <climits>
+#include <cstdio>
 
 namespace Test { namespace Int {
 
@@ -479,6 +480,131 @@ namespace Test { namespace Int {
 
 
 
+     /// %Test with large tuple set
+     class TupleSetLarge : public Test {
+       mutable Gecode::TupleSet t;
+     protected:
+       /// Extensional propagation kind
+       Gecode::ExtensionalPropKind epk;
+     public:
+       /// Create and register test
+       TupleSetLarge(Gecode::ExtensionalPropKind epk0, double prob)
+         : Test("Extensional::TupleSet::Large::"+str(epk0),
+                4,0,4,false,Gecode::ICL_DOM), epk(epk0) {
+         using namespace Gecode;
+
+         CpltAssignment ass(4, IntSet(0, 4));
+         while (ass()) {
+           if (Base::rand(100) <= prob*100) {
+             IntArgs tuple(4);
+             for (int i = 4; i--; ) tuple[i] = ass[i];
+             t.add(tuple);
+           }
+           ++ass;
+         }
+         t.finalize();
+       }
+       /// %Test whether \a x is solution
+       virtual bool solution(const Assignment& x) const {
+         using namespace Gecode;
+         for (int i = 0; i < t.tuples(); ++i) {
+           TupleSet::Tuple l = t[i];
+           bool same = true;
+           for (int j = 0; j < t.arity() && same; ++j)
+             if (l[j] != x[j]) same = false;
+           if (same) return true;
+         }
+         return false;
+       }
+       /// Post constraint on \a x
+       virtual void post(Gecode::Space& home, Gecode::IntVarArray& x) {
+         using namespace Gecode;
+         extensional(home, x, t, epk, ICL_DEF);
+       }
+     };
+
+     /// %Test with tuple set saved to and read from a file
+     class TupleSetFile : public Test {
+       /// Tuple set as created
+       mutable Gecode::TupleSet t;
+       /// Tuple set as read from file
+       mutable Gecode::TupleSet f;
+     protected:
+       /// Extensional propagation kind
+       Gecode::ExtensionalPropKind epk;
+     public:
+       /// Create and register test
+       TupleSetFile(Gecode::ExtensionalPropKind epk0, double prob)
+         : Test("Extensional::TupleSet::File::"+str(epk0),
+                3,-2,2,false,Gecode::ICL_DOM), epk(epk0) {
+         using namespace Gecode;
+
+         CpltAssignment ass(3, IntSet(-2, 2));
+         while (ass()) {
+           if (Base::rand(100) <= prob*100) {
+             IntArgs tuple(3);
+             for (int i = 3; i--; ) tuple[i] = ass[i];
+             t.add(tuple);
+           }
+           ++ass;
+         }
+         t.finalize();
+         std::string fn = "gecode-test-tuple-set-"+str(epk0)+".tmp";
+         t.save(fn);
+         f = TupleSet(fn);
+         std::remove(fn.c_str());
+       }
+       /// %Test whether \a x is solution
+       virtual bool solution(const Assignment& x) const {
+         using namespace Gecode;
+         for (int i = 0; i < t.tuples(); ++i) {
+           TupleSet::Tuple l = t[i];
+           bool same = true;
+           for (int j = 0; j < t.arity() && same; ++j)
+             if (l[j] != x[j]) same = false;
+           if (same) return true;
+         }
+         return false;
+       }
+       /// Post constraint on \a x
+       virtual void post(Gecode::Space& home, Gecode::IntVarArray& x) {
+         using namespace Gecode;
+         extensional(home, x, f, epk, ICL_DEF);
+       }
+     };
+
+     /// %Test with tuple set and shared variables
+     class TupleSetShared : public Test {
+     protected:
+       /// Extensional propagation kind
+       Gecode::ExtensionalPropKind epk;
+     public:
+       /// Create and register test
+       TupleSetShared(Gecode::ExtensionalPropKind epk0)
+         : Test("Extensional::TupleSet::Shared::"+str(epk0),
+                3,1,5,false), epk(epk0) {}
+       /// %Test whether \a x is solution
+       virtual bool solution(const Assignment& x) const {
+         return ((x[0] == 2 && x[1] == 1 && x[2] == 4) ||
+                 (x[0] == 3 && x[1] == 3 && x[2] == 2) ||
+                 (x[0] == 4 && x[1] == 3 && x[2] == 1));
+       }
+       /// Post constraint on \a x
+       virtual void post(Gecode::Space& home, Gecode::IntVarArray& x) {
+         using namespace Gecode;
+         TupleSet t;
+         t.add(IntArgs(4,  2, 1, 2, 4));
+         t.add(IntArgs(4,  2, 2, 1, 4));
+         t.add(IntArgs(4,  4, 3, 4, 1));
+         t.add(IntArgs(4,  1, 3, 2, 3));
+         t.add(IntArgs(4,  3, 3, 3, 2));
+         t.finalize();
+         IntVarArgs y(4);
+         y[0]=x[0]; y[1]=x[1]; y[2]=x[0]; y[3]=x[2];
+         extensional(home, y, t, epk, ICL_DEF);
+       }
+     };
+
      /// %Test with bool tuple set
      class TupleSetBool : public Test {
        mutable Gecode::TupleSet t;
@@ -553,14 +679,85 @@ namespace Test { namespace Int {
      RegOpt ro6(static_cast<int>(USHRT_MAX-1));
      RegOpt ro7(static_cast<int>(USHRT_MAX));
 
+     /// %Test with DFA built as decision diagram from a tuple set
+     class TupleSetMDD : public Test {
+       mutable Gecode::TupleSet t;
+     protected:
+       /// Whether to use Boolean variables
+       bool b;
+     public:
+       /// Create and register test
+       TupleSetMDD(const std::string& s, int n, int min, int max,
+                   double prob, bool b0)
+         : Test("Extensional::TupleSet::MDD::"+s,
+                n,min,max,false,Gecode::ICL_DOM), b(b0) {
+         using namespace Gecode;
+
+         CpltAssignment ass(n, IntSet(min, max));
+         while (ass()) {
+           if (Base::rand(100) <= prob*100) {
+             IntArgs tuple(n);
+             for (int i = n; i--; ) tuple[i] = ass[i];
+             t.add(tuple);
+             // Add some tuples twice
+             if (Base::rand(8) == 0)
+               t.add(tuple);
+           }
+           ++ass;
+         }
+         t.finalize();
+       }
+       /// %Test whether \a x is solution
+       virtual bool solution(const Assignment& x) const {
+         using namespace Gecode;
+         for (int i = 0; i < t.tuples(); ++i) {
+           TupleSet::Tuple l = t[i];
+           bool same = true;
+           for (int j = 0; j < t.arity() && same; ++j)
+             if (l[j] != x[j]) same = false;
+           if (same) return true;
+         }
+         return false;
+       }
+       /// Post constraint on \a x
+       virtual void post(Gecode::Space& home, Gecode::IntVarArray& x) {
+         using namespace Gecode;
+         if (b) {
+           BoolVarArgs y(x.size());
+           for (int i = x.size(); i--; ) y[i] = channel(home, x[i]);
+           extensional(home, y, DFA(t));
+         } else {
+           extensional(home, x, DFA(t));
+         }
+       }
+     };
+
      TupleSetA tsam(Gecode::EPK_MEMORY);
      TupleSetA tsas(Gecode::EPK_SPEED);
+     TupleSetA tsac(Gecode::EPK_COMPACT);
 
      TupleSetB tsbm(Gecode::EPK_MEMORY);
      TupleSetB tsbs(Gecode::EPK_SPEED);
+     TupleSetB tsbc(Gecode::EPK_COMPACT);
+
+     TupleSetLarge tslm(Gecode::EPK_MEMORY, 0.5);
+     TupleSetLarge tsls(Gecode::EPK_SPEED, 0.5);
+     TupleSetLarge tslc(Gecode::EPK_COMPACT, 0.5);
+
+     TupleSetFile tsfm(Gecode::EPK_MEMORY, 0.3);
+     TupleSetFile tsfs(Gecode::EPK_SPEED, 0.3);
+     TupleSetFile tsfc(Gecode::EPK_COMPACT, 0.3);
+
+     TupleSetShared tssm(Gecode::EPK_MEMORY);
+     TupleSetShared tssc(Gecode::EPK_COMPACT);
 
      TupleSetBool tsboolm(Gecode::EPK_MEMORY, 0.3);
      TupleSetBool tsbools(Gecode::EPK_SPEED, 0.3);
+     TupleSetBool tsboolc(Gecode::EPK_COMPACT, 0.3);
+
+     TupleSetMDD tsmdda("A", 4, -2, 2, 0.3, false);
+     TupleSetMDD tsmddb("B", 3, 0, 4, 0.7, false);
+     TupleSetMDD tsmddbool("Bool", 5, 0, 1, 0.3, true);
      //@}
 
    }
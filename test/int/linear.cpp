@@ -145,6 +145,49 @@ namespace Test { namespace Int {
        }
      };
 
+     /// %Test linear relation over many integer variables
+     class IntLarge : public Test {
+     protected:
+       /// Coefficients
+       Gecode::IntArgs a;
+       /// Integer relation type to propagate
+       Gecode::IntRelType irt;
+     public:
+       /// Create and register test
+       IntLarge(const std::string& s, const Gecode::IntSet& d,
+                const Gecode::IntArgs& a0, Gecode::IntRelType irt0)
+         : Test("Linear::Int::Large::"+
+                str(irt0)+"::"+s+"::"+str(a0.size()),
+                a0.size(),d,false),
+         a(a0), irt(irt0) {}
+       /// %Test whether \a x is solution
+       virtual bool solution(const Assignment& x) const {
+         double e = 0.0;
+         for (int i=0; i<x.size(); i++)
+           e += a[i]*x[i];
+         return cmp(e, irt, static_cast<double>(0));
+       }
+       /// Post constraint on \a x
+       virtual void post(Gecode::Space& home, Gecode::IntVarArray& x) {
+         using namespace Gecode;
+         // Add enough variables (fixed to zero afterwards) such that
+         // the propagators for many views are used
+         int n = x.size();
+         int m = 300;
+         IntArgs b(n+m);
+         IntVarArgs y(n+m), z(m);
+         for (int i=n; i--; ) {
+           b[i] = a[i]; y[i] = x[i];
+         }
+         for (int i=m; i--; ) {
+           b[n+i] = (i & 1) ? i+1 : -i-1;
+           y[n+i] = z[i] = Gecode::IntVar(home,-2,2);
+         }
+         linear(home, b, y, irt, 0);
+         rel(home, z, IRT_EQ, 0);
+       }
+     };
+
      /// %Test linear relation over Boolean variables equal to constant
      class BoolInt : public Test {
      protected:
@@ -320,6 +363,16 @@ namespace Test { namespace Int {
                (void) new IntVar("15",d1,a5,IRT_EQ,ICL_DOM);
              }
            }
+
+           for (int i=1; i<=4; i++) {
+             IntArgs a4(i, av4);
+             IntArgs a5(i, av5);
+             for (IntRelTypes irts; irts(); ++irts) {
+               (void) new IntLarge("14",d1,a4,irts.irt());
+               (void) new IntLarge("15",d1,a5,irts.irt());
+               (void) new IntLarge("25",d2,a5,irts.irt());
+             }
+           }
          }
          {
            const int av1[10] = { 
@@ -293,7 +293,7 @@ namespace Test {
     };
 
     /// %Test for depth-first search
-    template<class Model>
+    template<class Model, template<class> class Engine>
     class DFS : public Test {
     private:
       /// Minimal recomputation distance
@@ -304,9 +304,10 @@ namespace Test {
       unsigned int t;
     public:
       /// Initialize test
-      DFS(HowToBranch htb1, HowToBranch htb2, HowToBranch htb3,
+      DFS(const std::string& e,
+          HowToBranch htb1, HowToBranch htb2, HowToBranch htb3,
           unsigned int c_d0, unsigned int a_d0, unsigned int t0)
-        : Test("DFS::"+Model::name()+"::"+
+        : Test(e+"::"+Model::name()+"::"+
                str(htb1)+"::"+str(htb2)+"::"+str(htb3)+"::"+
                str(c_d0)+"::"+str(a_d0)+"::"+str(t0),
                htb1,htb2,htb3), c_d(c_d0), a_d(a_d0), t(t0) {}
@@ -319,7 +320,7 @@ namespace Test {
         o.a_d = a_d;
         o.threads = t;
         o.stop = &f;
-        Gecode::DFS<Model> dfs(m,o);
+        Engine<Model> dfs(m,o);
         int n = m->solutions();
         delete m;
         while (true) {
@@ -335,6 +336,51 @@ namespace Test {
       }
     };
 
+    /// %Test for limited discrepancy search
+    template<class Model>
+    class LDS : public Test {
+    private:
+      /// Minimal recomputation distance
+      unsigned int c_d;
+      /// Adaptive recomputation distance
+      unsigned int a_d;
+      /// Number of threads
+      unsigned int t;
+    public:
+      /// Initialize test
+      LDS(HowToBranch htb1, HowToBranch htb2, HowToBranch htb3,
+          unsigned int c_d0, unsigned int a_d0, unsigned int t0)
+        : Test("LDS::"+Model::name()+"::"+
+               str(htb1)+"::"+str(htb2)+"::"+str(htb3)+"::"+
+               str(c_d0)+"::"+str(a_d0)+"::"+str(t0),
+               htb1,htb2,htb3), c_d(c_d0), a_d(a_d0), t(t0) {}
+      /// Run test
+      virtual bool run(void) {
+        Model* m = new Model(htb1,htb2,htb3);
+        Gecode::Search::FailStop f(2);
+        Gecode::Search::Options o;
+        o.c_d = c_d;
+        o.a_d = a_d;
+        o.threads = t;
+        // Large enough to explore the entire tree
+        o.d_l = 64;
+        o.stop = &f;
+        Gecode::LDS<Model> lds(m,o);
+        int n = m->solutions();
+        delete m;
+        while (true) {
+          Model* s = lds.next();
+          if (s != NULL) {
+            n--; delete s;
+          }
+          if ((s == NULL) && !lds.stopped())
+            break;
+          f.limit(f.limit()+2);
+        }
+        return n == 0;
+      }
+    };
+
     /// %Test for best solution search
     template<class Model, template<class> class Engine>
     class Best : public Test {
@@ -345,15 +391,19 @@ namespace Test {
       unsigned int a_d;
       /// Number of threads
       unsigned int t;
+      /// Whether to restart according to a Luby cutoff sequence
+      bool luby;
     public:
       /// Initialize test
       Best(const std::string& b, HowToConstrain htc,
            HowToBranch htb1, HowToBranch htb2, HowToBranch htb3,
-           unsigned int c_d0, unsigned int a_d0, unsigned int t0)
+           unsigned int c_d0, unsigned int a_d0, unsigned int t0,
+           bool luby0=false)
         : Test(b+"::"+Model::name()+"::"+str(htc)+"::"+
                str(htb1)+"::"+str(htb2)+"::"+str(htb3)+"::"+
                str(c_d0)+"::"+str(a_d0)+"::"+str(t0),
-               htb1,htb2,htb3,htc), c_d(c_d0), a_d(a_d0), t(t0) {}
+               htb1,htb2,htb3,htc), c_d(c_d0), a_d(a_d0), t(t0),
+          luby(luby0) {}
       /// Run test
       virtual bool run(void) {
         Model* m = new Model(htb1,htb2,htb3,htc);
@@ -363,6 +413,7 @@ namespace Test {
         o.a_d = a_d;
         o.threads = t;
         o.stop = &f;
+        o.cutoff = luby ? Gecode::Search::Cutoff::luby(1) : NULL;
         Engine<Model> best(m,o);
         delete m;
         Model* b = NULL;
@@ -377,10 +428,79 @@ namespace Test {
         }
         bool ok = (b == NULL) || b->best();
         delete b;
+        delete o.cutoff;
         return ok;
       }
     };
 
+    /// Portfolio of depth-first search engines
+    template<class T>
+    class PortfolioDFS : public Gecode::Portfolio<T,Gecode::DFS> {
+    public:
+      /// Initialize engine for space \a s and options \a o
+      PortfolioDFS(T* s, const Gecode::Search::Options& o)
+        : Gecode::Portfolio<T,Gecode::DFS>(s,o) {}
+    };
+
+    /// Portfolio of branch-and-bound search engines
+    template<class T>
+    class PortfolioBAB : public Gecode::Portfolio<T,Gecode::BAB> {
+    public:
+      /// Initialize engine for space \a s and options \a o
+      PortfolioBAB(T* s, const Gecode::Search::Options& o)
+        : Gecode::Portfolio<T,Gecode::BAB>(s,o) {}
+    };
+
+    /// Return options \a o with recomputation-only restoration
+    Gecode::Search::Options recompute(const Gecode::Search::Options& o) {
+      Gecode::Search::Options ro(o);
+      ro.restore = Gecode::Search::RS_RECOMPUTE;
+      return ro;
+    }
+
+    /// Depth-first search engine restoring by recomputation only
+    template<class T>
+    class RecomputeDFS : public Gecode::DFS<T> {
+    public:
+      /// Initialize engine for space \a s and options \a o
+      RecomputeDFS(T* s, const Gecode::Search::Options& o)
+        : Gecode::DFS<T>(s,recompute(o)) {}
+    };
+
+    /// Branch-and-bound search engine restoring by recomputation only
+    template<class T>
+    class RecomputeBAB : public Gecode::BAB<T> {
+    public:
+      /// Initialize engine for space \a s and options \a o
+      RecomputeBAB(T* s, const Gecode::Search::Options& o)
+        : Gecode::BAB<T>(s,recompute(o)) {}
+    };
+
+    /// Return options \a o with learning from failures
+    Gecode::Search::Options learn(const Gecode::Search::Options& o) {
+      Gecode::Search::Options lo(o);
+      lo.learn = 16;
+      return lo;
+    }
+
+    /// Depth-first search engine learning from failures
+    template<class T>
+    class LearnDFS : public Gecode::DFS<T> {
+    public:
+      /// Initialize engine for space \a s and options \a o
+      LearnDFS(T* s, const Gecode::Search::Options& o)
+        : Gecode::DFS<T>(s,learn(o)) {}
+    };
+
+    /// Restart search engine learning from failures
+    template<class T>
+    class LearnRestart : public Gecode::Restart<T> {
+    public:
+      /// Initialize engine for space \a s and options \a o
+      LearnRestart(T* s, const Gecode::Search::Options& o)
+        : Gecode::Restart<T>(s,learn(o)) {}
+    };
+
     /// Iterator for branching types
     class BranchTypes {
     private:
@@ -441,17 +561,62 @@ namespace Test {
       /// Perform creation and registration
       Create(void) {
         // Depth-first search
+        for (unsigned int t = 1; t<=4; t++)
+          for (unsigned int c_d = 1; c_d<10; c_d++)
+            for (unsigned int a_d = 1; a_d<=c_d; a_d++) {
+              for (BranchTypes htb1; htb1(); ++htb1)
+                for (BranchTypes htb2; htb2(); ++htb2)
+                  for (BranchTypes htb3; htb3(); ++htb3) {
+                    (void) new DFS<HasSolutions,Gecode::DFS>
+                      ("DFS",htb1.htb(),htb2.htb(),htb3.htb(),c_d, a_d, t);
+                    (void) new DFS<HasSolutions,PortfolioDFS>
+                      ("Portfolio::DFS",htb1.htb(),htb2.htb(),htb3.htb(),
+                       c_d, a_d, t);
+                  }
+              new DFS<FailImmediate,Gecode::DFS>
+                ("DFS",HTB_NONE, HTB_NONE, HTB_NONE, c_d, a_d, t);
+              new DFS<HasSolutions,Gecode::DFS>
+                ("DFS",HTB_NONE, HTB_NONE, HTB_NONE, c_d, a_d, t);
+              new DFS<FailImmediate,PortfolioDFS>
+                ("Portfolio::DFS",HTB_NONE, HTB_NONE, HTB_NONE, c_d, a_d, t);
+            }
+        // Depth-first search with recomputation only
+        for (unsigned int t = 1; t<=4; t++) {
+          for (BranchTypes htb1; htb1(); ++htb1)
+            for (BranchTypes htb2; htb2(); ++htb2)
+              for (BranchTypes htb3; htb3(); ++htb3)
+                (void) new DFS<HasSolutions,RecomputeDFS>
+                  ("Recompute::DFS",htb1.htb(),htb2.htb(),htb3.htb(),1,1,t);
+          new DFS<FailImmediate,RecomputeDFS>
+            ("Recompute::DFS",HTB_NONE, HTB_NONE, HTB_NONE, 1, 1, t);
+        }
+        // Depth-first search learning from failures
+        for (unsigned int t = 1; t<=4; t++)
+          for (unsigned int c_d = 1; c_d<10; c_d += 4) {
+            // Learning prunes more for branchings with a single alternative
+            for (BranchTypes htb1; htb1(); ++htb1)
+              for (BranchTypes htb2; htb2(); ++htb2)
+                for (BranchTypes htb3; htb3(); ++htb3)
+                  if ((htb1.htb() != HTB_UNARY) && (htb2.htb() != HTB_UNARY))
+                    (void) new DFS<HasSolutions,LearnDFS>
+                      ("Learn::DFS",htb1.htb(),htb2.htb(),htb3.htb(),
+                       c_d,c_d,t);
+            new DFS<FailImmediate,LearnDFS>
+              ("Learn::DFS",HTB_NONE, HTB_NONE, HTB_NONE, c_d, c_d, t);
+          }
+
+        // Limited discrepancy search
         for (unsigned int t = 1; t<=4; t++)
           for (unsigned int c_d = 1; c_d<10; c_d++)
             for (unsigned int a_d = 1; a_d<=c_d; a_d++) {
               for (BranchTypes htb1; htb1(); ++htb1)
                 for (BranchTypes htb2; htb2(); ++htb2)
                   for (BranchTypes htb3; htb3(); ++htb3)
-                    (void) new DFS<HasSolutions>(htb1.htb(),htb2.htb(),htb3.htb(),
+                    (void) new LDS<HasSolutions>(htb1.htb(),htb2.htb(),htb3.htb(),
                                                  c_d, a_d, t);
-              new DFS<FailImmediate>(HTB_NONE, HTB_NONE, HTB_NONE, 
+              new LDS<FailImmediate>(HTB_NONE, HTB_NONE, HTB_NONE, 
                                      c_d, a_d, t);
-              new DFS<HasSolutions>(HTB_NONE, HTB_NONE, HTB_NONE, 
+              new LDS<HasSolutions>(HTB_NONE, HTB_NONE, HTB_NONE, 
                                     c_d, a_d, t);
             }
 
@@ -469,12 +634,49 @@ namespace Test {
                       (void) new Best<HasSolutions,Restart>
                         ("Restart",htc.htc(),htb1.htb(),htb2.htb(),htb3.htb(),
                          c_d,a_d,t);
+                      (void) new Best<HasSolutions,Restart>
+                        ("Restart::Luby",htc.htc(),
+                         htb1.htb(),htb2.htb(),htb3.htb(),
+                         c_d,a_d,t,true);
+                      (void) new Best<HasSolutions,LNS>
+                        ("LNS",htc.htc(),htb1.htb(),htb2.htb(),htb3.htb(),
+                         c_d,a_d,t);
+                      (void) new Best<HasSolutions,PortfolioBAB>
+                        ("Portfolio::BAB",htc.htc(),
+                         htb1.htb(),htb2.htb(),htb3.htb(),c_d,a_d,t);
                   }
               (void) new Best<FailImmediate,BAB>
                 ("BAB",HTC_NONE,HTB_NONE,HTB_NONE,HTB_NONE,c_d,a_d,t);
               (void) new Best<HasSolutions,BAB>
                 ("BAB",HTC_NONE,HTB_NONE,HTB_NONE,HTB_NONE,c_d,a_d,t);
+              (void) new Best<FailImmediate,PortfolioBAB>
+                ("Portfolio::BAB",HTC_NONE,HTB_NONE,HTB_NONE,HTB_NONE,
+                 c_d,a_d,t);
             }
+        // Best solution search with recomputation only
+        for (unsigned int t = 1; t<=4; t++) {
+          for (ConstrainTypes htc; htc(); ++htc)
+            for (BranchTypes htb1; htb1(); ++htb1)
+              for (BranchTypes htb2; htb2(); ++htb2)
+                for (BranchTypes htb3; htb3(); ++htb3)
+                  (void) new Best<HasSolutions,RecomputeBAB>
+                    ("Recompute::BAB",htc.htc(),htb1.htb(),htb2.htb(),
+                     htb3.htb(),1,1,t);
+          (void) new Best<FailImmediate,RecomputeBAB>
+            ("Recompute::BAB",HTC_NONE,HTB_NONE,HTB_NONE,HTB_NONE,1,1,t);
+        }
+        // Restart search learning from failures
+        for (unsigned int t = 1; t<=4; t++) {
+          for (ConstrainTypes htc; htc(); ++htc)
+            for (BranchTypes htb1; htb1(); ++htb1)
+              for (BranchTypes htb2; htb2(); ++htb2)
+                for (BranchTypes htb3; htb3(); ++htb3)
+                  (void) new Best<HasSolutions,LearnRestart>
+                    ("Learn::Restart::Luby",htc.htc(),htb1.htb(),htb2.htb(),
+                     htb3.htb(),1,1,t,true);
+          (void) new Best<FailImmediate,LearnRestart>
+            ("Learn::Restart",HTC_NONE,HTB_NONE,HTB_NONE,HTB_NONE,1,1,t);
+        }
         
       }
     };
@@ -68,8 +68,11 @@ int main(int argc, char** argv) {
 
   if (fg) {
     
-    fg->createBranchers(fg->solveAnnotations(), false, std::cerr);
-    fg->shrinkArrays(p);
+    // For portfolio search, branchers are created for each asset
+    if ((opt.assets() <= 1) || (opt.mode() == SM_GIST)) {
+      fg->createBranchers(fg->solveAnnotations(), false, std::cerr);
+      fg->shrinkArrays(p);
+    }
     if (opt.output()) {
       std::ofstream os(opt.output());
       if (!os.good()) {